@@ -0,0 +1,72 @@
+/**
+ * @file IrBench.h
+ * @brief Стенд декодера ІЧ-пульта: відтворення записаних кадрів без натискання кнопок.
+ *
+ * Корпус (corpus/<назва>.ircorpus) — сирі тривалості імпульсів і пауз кадрів
+ * пульта: чисті, з шумом (тремтіння і подовження імпульсів приймачем),
+ * обірвані, кадри повтору, кадри з тривалостями на межі допуску декодера
+ * та кадри поза допуском (зокрема ті кадри з шумом, які еталонний
+ * декодер не приймає — їх мітка none). tools/ir_corpus.py генерує або
+ * імпортує корпус, перевіряє його мітки еталонним декодером на комп’ютері
+ * й перетворює на include/IrCorpus.h — масиви тиків по 50 мкс у PROGMEM.
+ *
+ * Середовище uno_irbench (src/IrBench.cpp) замість основної програми
+ * записує кожен кадр у буфер приймача IRremote (irparams.rawbuf) так, ніби
+ * його щойно прийняло переривання, і викликає той самий
+ * irrecv.decode(&results), що й IR_Control. Приймач не вмикається
+ * (enableIRIn() не викликається), тож пін D2 не потрібен: стенд однаково
+ * працює на платі та в simavr.
+ *
+ * Звіт у порт (115200 бод):
+ * - для кожного виду кадрів — скільки розпізнано з очікуваним кодом,
+ *   з іншим кодом, не розпізнано, та такти decode() (середні й найбільші,
+ *   Timer1 з подільником 8 — крок 8 тактів);
+ * - для серії повторів із різним періодом — скільки кадрів втрачено.
+ *   Приймач стоїть від кінця кадру до resume() одразу після decode(); код
+ *   програма друкує вже після resume(), тож наступний кадр приймається,
+ *   але декодується лише тоді, коли програма допише попередній у порт.
+ *   Кадри, що почалися, поки приймач стоїть, пропускаються.
+ *
+ * Оновлення корпусу:
+ *  python tools/ir_corpus.py generate --out corpus/remote.ircorpus
+ *  python tools/ir_corpus.py header corpus/remote.ircorpus --out include/IrCorpus.h
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef IRBENCH_H
+#define IRBENCH_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Вид кадру в корпусі.
+ */
+enum IrCorpusKind
+{
+  IR_KIND_CLEAN,      ///< Чистий кадр із номінальними тривалостями
+  IR_KIND_NOISY,      ///< Кадр із тремтінням фронтів
+  IR_KIND_TRUNCATED,  ///< Обірваний кадр — не повинен розпізнаватися
+  IR_KIND_REPEAT,     ///< Кадр повтору (утримання кнопки)
+  IR_KIND_EDGE,       ///< Тривалості одразу всередині допуску декодера
+  IR_KIND_OUTSIDE,    ///< Тривалості поза допуском — не повинен розпізнаватися
+  IR_KIND_COUNT
+};
+
+const uint32_t IR_EXPECT_NONE = 0;     ///< Очікуваний «код» кадру, який не має розпізнаватися
+const uint8_t IR_CORPUS_TICK_US = 50;  ///< Тривалість тику в корпусі, мкс (як у IRremote)
+
+/**
+ * @brief Кадр корпусу (зберігається в PROGMEM).
+ */
+struct IrCorpusFrame
+{
+  uint8_t kind;          ///< IrCorpusKind
+  uint8_t length;        ///< Кількість тривалостей (імпульс першим)
+  uint32_t expect;       ///< Очікуване results.value або IR_EXPECT_NONE
+  const uint8_t *ticks;  ///< Тривалості в тиках по 50 мкс (PROGMEM)
+};
+
+#endif  // IRBENCH_H
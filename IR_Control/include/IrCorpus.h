@@ -0,0 +1,406 @@
+/**
+ * @file IrCorpus.h
+ * @brief Корпус ІЧ-кадрів для середовища uno_irbench (тики по 50 мкс).
+ *
+ * Згенеровано tools/ir_corpus.py з corpus/remote.ircorpus — не редагуйте вручну.
+ */
+
+#ifndef IRCORPUS_H
+#define IRCORPUS_H
+
+#include "IrBench.h"
+
+static const uint8_t IR_FRAME_0[] PROGMEM = {  // nec-FFE0E1-clean
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_1[] PROGMEM = {  // nec-FFE0E1-noisy0
+  178, 88, 12, 10, 12, 10, 11, 11, 12, 10, 10, 11, 11, 11, 12, 11,
+  11, 11, 12, 32, 11, 33, 10, 35, 11, 33, 11, 32, 11, 33, 11, 33,
+  12, 34, 11, 32, 12, 32, 11, 33, 12, 10, 12, 10, 12, 10, 12, 10,
+  10, 11, 10, 32, 10, 33, 10, 32, 12, 9, 10, 11, 11, 10, 12, 12,
+  11, 33, 11
+};
+static const uint8_t IR_FRAME_2[] PROGMEM = {  // nec-FFE0E1-noisy1
+  176, 85, 14, 9, 12, 9, 11, 9, 13, 10, 12, 10, 13, 11, 12, 10,
+  12, 10, 13, 31, 13, 31, 12, 32, 12, 31, 13, 32, 12, 31, 11, 32,
+  14, 32, 13, 31, 11, 31, 11, 31, 13, 10, 12, 10, 12, 9, 13, 10,
+  12, 10, 13, 32, 13, 31, 13, 32, 12, 9, 12, 11, 12, 9, 11, 9,
+  12, 32, 13
+};
+static const uint8_t IR_FRAME_3[] PROGMEM = {  // nec-FFE0E1-noisy2
+  177, 87, 13, 10, 12, 9, 12, 10, 12, 9, 13, 10, 13, 10, 11, 9,
+  12, 10, 11, 32, 11, 32, 12, 32, 12, 32, 12, 32, 12, 31, 12, 33,
+  12, 32, 12, 32, 11, 31, 13, 32, 12, 9, 12, 10, 12, 9, 13, 9,
+  13, 10, 12, 32, 11, 32, 12, 32, 13, 10, 13, 10, 12, 10, 12, 10,
+  12, 32, 12
+};
+static const uint8_t IR_FRAME_4[] PROGMEM = {  // nec-FFE0E1-noisy3
+  176, 88, 11, 10, 11, 11, 10, 10, 10, 10, 12, 10, 11, 10, 11, 10,
+  11, 10, 11, 32, 12, 32, 11, 32, 13, 33, 12, 32, 10, 33, 12, 32,
+  11, 33, 11, 32, 12, 33, 12, 33, 11, 10, 12, 10, 12, 11, 12, 9,
+  11, 10, 12, 32, 11, 31, 11, 32, 12, 9, 12, 11, 11, 11, 11, 11,
+  11, 33, 11
+};
+static const uint8_t IR_FRAME_5[] PROGMEM = {  // nec-FFE0E1-noisy4
+  188, 93, 13, 10, 13, 10, 12, 11, 14, 11, 13, 11, 13, 11, 13, 11,
+  12, 10, 13, 34, 12, 34, 12, 34, 13, 33, 13, 34, 14, 34, 12, 34,
+  14, 33, 13, 34, 12, 34, 13, 34, 13, 10, 13, 11, 13, 10, 13, 10,
+  12, 10, 14, 34, 12, 34, 13, 34, 12, 10, 13, 9, 13, 10, 13, 10,
+  13, 35, 12
+};
+static const uint8_t IR_FRAME_6[] PROGMEM = {  // nec-FFE0E1-noisy5
+  182, 88, 13, 10, 12, 10, 12, 11, 12, 11, 11, 10, 11, 10, 12, 9,
+  13, 11, 13, 33, 12, 33, 14, 32, 12, 33, 12, 34, 12, 33, 12, 33,
+  12, 33, 12, 33, 13, 32, 12, 33, 13, 10, 12, 10, 12, 10, 12, 10,
+  12, 9, 13, 34, 11, 33, 12, 32, 12, 10, 12, 11, 12, 11, 12, 11,
+  12, 33, 13
+};
+static const uint8_t IR_FRAME_7[] PROGMEM = {  // nec-FFE0E1-noisy6
+  182, 91, 12, 11, 12, 11, 12, 11, 12, 11, 11, 11, 12, 12, 12, 10,
+  12, 11, 13, 34, 12, 33, 12, 33, 11, 34, 11, 35, 11, 33, 12, 34,
+  11, 34, 13, 33, 11, 35, 11, 34, 11, 11, 12, 10, 12, 11, 12, 12,
+  12, 12, 12, 34, 12, 35, 12, 35, 11, 10, 11, 11, 11, 11, 12, 10,
+  11, 33, 12
+};
+static const uint8_t IR_FRAME_8[] PROGMEM = {  // nec-FFE0E1-noisy7
+  175, 86, 13, 10, 12, 10, 12, 10, 13, 9, 12, 10, 12, 10, 12, 10,
+  12, 10, 13, 31, 12, 32, 13, 31, 13, 32, 13, 31, 12, 32, 12, 32,
+  13, 31, 12, 31, 13, 31, 11, 31, 12, 9, 13, 10, 13, 11, 12, 10,
+  12, 9, 13, 31, 12, 32, 11, 32, 12, 11, 12, 10, 13, 10, 13, 10,
+  12, 32, 12
+};
+static const uint8_t IR_FRAME_9[] PROGMEM = {  // nec-FFE0E1-cut0
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11
+};
+static const uint8_t IR_FRAME_10[] PROGMEM = {  // nec-FFE0E1-cut1
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11
+};
+static const uint8_t IR_FRAME_11[] PROGMEM = {  // nec-FFE0E1-cut2
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11
+};
+static const uint8_t IR_FRAME_12[] PROGMEM = {  // nec-FF02FD-clean
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 34,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_13[] PROGMEM = {  // nec-FF02FD-noisy0
+  185, 90, 12, 10, 12, 10, 12, 11, 12, 10, 14, 10, 13, 11, 14, 10,
+  12, 10, 13, 34, 13, 34, 13, 34, 12, 33, 13, 33, 13, 33, 12, 33,
+  12, 35, 12, 11, 12, 10, 11, 10, 13, 10, 13, 9, 14, 10, 14, 33,
+  13, 10, 13, 34, 12, 34, 13, 33, 13, 33, 12, 33, 13, 33, 13, 11,
+  12, 33, 13
+};
+static const uint8_t IR_FRAME_14[] PROGMEM = {  // nec-FF02FD-noisy1
+  174, 85, 12, 10, 12, 10, 11, 10, 11, 11, 12, 10, 11, 10, 11, 10,
+  11, 10, 11, 31, 12, 32, 11, 31, 12, 32, 12, 32, 10, 31, 11, 32,
+  11, 32, 13, 9, 12, 10, 11, 10, 12, 11, 11, 9, 12, 11, 13, 31,
+  11, 10, 11, 31, 12, 32, 12, 32, 12, 32, 12, 31, 12, 32, 11, 10,
+  11, 32, 10
+};
+static const uint8_t IR_FRAME_15[] PROGMEM = {  // nec-FF02FD-noisy2
+  179, 90, 11, 11, 12, 11, 12, 11, 13, 12, 11, 11, 11, 10, 11, 11,
+  13, 11, 12, 34, 12, 34, 11, 35, 11, 33, 11, 33, 13, 33, 11, 33,
+  11, 34, 12, 10, 11, 11, 12, 10, 11, 11, 10, 11, 11, 11, 11, 33,
+  12, 11, 12, 34, 12, 34, 11, 33, 10, 34, 12, 34, 10, 33, 12, 11,
+  11, 34, 12
+};
+static const uint8_t IR_FRAME_16[] PROGMEM = {  // nec-FF02FD-noisy3
+  186, 93, 11, 12, 12, 12, 12, 11, 12, 11, 12, 11, 12, 11, 11, 11,
+  12, 10, 12, 34, 13, 35, 12, 35, 12, 36, 12, 35, 12, 34, 11, 34,
+  12, 35, 12, 11, 13, 11, 12, 12, 11, 12, 13, 11, 12, 12, 11, 35,
+  12, 11, 12, 34, 12, 34, 12, 35, 12, 35, 13, 33, 13, 34, 11, 12,
+  12, 35, 10
+};
+static const uint8_t IR_FRAME_17[] PROGMEM = {  // nec-FF02FD-noisy4
+  188, 91, 12, 10, 13, 10, 13, 10, 14, 10, 14, 10, 12, 11, 12, 10,
+  13, 9, 13, 33, 13, 34, 13, 34, 13, 33, 13, 34, 14, 34, 13, 33,
+  13, 33, 12, 10, 12, 10, 13, 10, 14, 11, 13, 11, 13, 11, 13, 34,
+  13, 10, 13, 33, 13, 33, 14, 34, 13, 35, 13, 32, 13, 35, 13, 10,
+  13, 34, 13
+};
+static const uint8_t IR_FRAME_18[] PROGMEM = {  // nec-FF02FD-noisy5
+  189, 93, 14, 12, 12, 11, 12, 11, 12, 12, 13, 11, 12, 10, 12, 11,
+  12, 11, 13, 35, 12, 35, 13, 35, 12, 35, 12, 36, 14, 34, 12, 34,
+  12, 35, 12, 10, 12, 11, 13, 12, 11, 12, 12, 12, 11, 11, 12, 36,
+  12, 11, 12, 34, 12, 35, 12, 35, 12, 34, 12, 35, 11, 35, 13, 11,
+  12, 35, 12
+};
+static const uint8_t IR_FRAME_19[] PROGMEM = {  // nec-FF02FD-noisy6
+  176, 86, 12, 10, 13, 10, 11, 8, 12, 9, 12, 11, 12, 10, 12, 10,
+  12, 9, 13, 32, 13, 31, 11, 32, 13, 32, 13, 32, 12, 31, 13, 31,
+  11, 32, 13, 10, 11, 10, 12, 10, 11, 10, 13, 10, 12, 10, 12, 31,
+  12, 10, 13, 32, 11, 31, 12, 33, 12, 31, 11, 32, 11, 32, 11, 9,
+  12, 33, 12
+};
+static const uint8_t IR_FRAME_20[] PROGMEM = {  // nec-FF02FD-noisy7
+  182, 88, 13, 9, 13, 9, 13, 10, 12, 9, 12, 9, 13, 10, 12, 10,
+  13, 10, 13, 33, 14, 32, 12, 33, 13, 32, 14, 32, 12, 32, 11, 34,
+  11, 32, 12, 9, 13, 10, 13, 10, 12, 10, 13, 10, 13, 11, 13, 32,
+  13, 11, 13, 32, 13, 34, 12, 32, 13, 33, 13, 33, 13, 33, 12, 9,
+  13, 32, 13
+};
+static const uint8_t IR_FRAME_21[] PROGMEM = {  // nec-FF02FD-cut0
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11
+};
+static const uint8_t IR_FRAME_22[] PROGMEM = {  // nec-FF02FD-cut1
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11
+};
+static const uint8_t IR_FRAME_23[] PROGMEM = {  // nec-FF02FD-cut2
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11
+};
+static const uint8_t IR_FRAME_24[] PROGMEM = {  // nec-repeat-clean
+  180, 45, 11
+};
+static const uint8_t IR_FRAME_25[] PROGMEM = {  // nec-repeat-noisy0
+  187, 47, 12
+};
+static const uint8_t IR_FRAME_26[] PROGMEM = {  // nec-repeat-noisy1
+  189, 48, 11
+};
+static const uint8_t IR_FRAME_27[] PROGMEM = {  // nec-repeat-noisy2
+  174, 43, 12
+};
+static const uint8_t IR_FRAME_28[] PROGMEM = {  // nec-repeat-noisy3
+  179, 43, 12
+};
+static const uint8_t IR_FRAME_29[] PROGMEM = {  // nec-repeat-noisy4
+  176, 43, 12
+};
+static const uint8_t IR_FRAME_30[] PROGMEM = {  // nec-repeat-noisy5
+  177, 42, 12
+};
+static const uint8_t IR_FRAME_31[] PROGMEM = {  // nec-repeat-noisy6
+  189, 46, 13
+};
+static const uint8_t IR_FRAME_32[] PROGMEM = {  // nec-repeat-noisy7
+  176, 44, 10
+};
+static const uint8_t IR_FRAME_33[] PROGMEM = {  // nec-FFE0E1-hdrmark-low-in
+  136, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_34[] PROGMEM = {  // nec-FFE0E1-hdrmark-low-out
+  135, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_35[] PROGMEM = {  // nec-FFE0E1-hdrmark-high-in
+  225, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_36[] PROGMEM = {  // nec-FFE0E1-hdrmark-high-out
+  226, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_37[] PROGMEM = {  // nec-FFE0E1-hdrspace-low-in
+  180, 68, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_38[] PROGMEM = {  // nec-FFE0E1-hdrspace-low-out
+  180, 67, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_39[] PROGMEM = {  // nec-FFE0E1-hdrspace-high-in
+  180, 112, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_40[] PROGMEM = {  // nec-FFE0E1-hdrspace-high-out
+  180, 113, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34, 11, 34,
+  11, 34, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 34, 11, 34, 11, 34, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 34, 11
+};
+static const uint8_t IR_FRAME_41[] PROGMEM = {  // nec-FFE0E1-mark-low-in
+  180, 90, 9, 11, 9, 11, 9, 11, 9, 11, 9, 11, 9, 11, 9, 11,
+  9, 11, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34,
+  9, 34, 9, 34, 9, 34, 9, 34, 9, 11, 9, 11, 9, 11, 9, 11,
+  9, 11, 9, 34, 9, 34, 9, 34, 9, 11, 9, 11, 9, 11, 9, 11,
+  9, 34, 9
+};
+static const uint8_t IR_FRAME_42[] PROGMEM = {  // nec-FFE0E1-mark-low-out
+  180, 90, 8, 11, 8, 11, 8, 11, 8, 11, 8, 11, 8, 11, 8, 11,
+  8, 11, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34,
+  8, 34, 8, 34, 8, 34, 8, 34, 8, 11, 8, 11, 8, 11, 8, 11,
+  8, 11, 8, 34, 8, 34, 8, 34, 8, 11, 8, 11, 8, 11, 8, 11,
+  8, 34, 8
+};
+static const uint8_t IR_FRAME_43[] PROGMEM = {  // nec-FFE0E1-mark-high-in
+  180, 90, 14, 11, 14, 11, 14, 11, 14, 11, 14, 11, 14, 11, 14, 11,
+  14, 11, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34,
+  14, 34, 14, 34, 14, 34, 14, 34, 14, 11, 14, 11, 14, 11, 14, 11,
+  14, 11, 14, 34, 14, 34, 14, 34, 14, 11, 14, 11, 14, 11, 14, 11,
+  14, 34, 14
+};
+static const uint8_t IR_FRAME_44[] PROGMEM = {  // nec-FFE0E1-mark-high-out
+  180, 90, 15, 11, 15, 11, 15, 11, 15, 11, 15, 11, 15, 11, 15, 11,
+  15, 11, 15, 34, 15, 34, 15, 34, 15, 34, 15, 34, 15, 34, 15, 34,
+  15, 34, 15, 34, 15, 34, 15, 34, 15, 11, 15, 11, 15, 11, 15, 11,
+  15, 11, 15, 34, 15, 34, 15, 34, 15, 11, 15, 11, 15, 11, 15, 11,
+  15, 34, 15
+};
+static const uint8_t IR_FRAME_45[] PROGMEM = {  // nec-FFE0E1-zero-low-in
+  180, 90, 11, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34, 9, 34,
+  9, 34, 9, 34, 9, 34, 9, 34, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 9, 9, 34, 9, 34, 9, 34, 9, 9, 9, 9, 9, 9, 9, 9,
+  9, 34, 9
+};
+static const uint8_t IR_FRAME_46[] PROGMEM = {  // nec-FFE0E1-zero-low-out
+  180, 90, 11, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34, 8, 34,
+  8, 34, 8, 34, 8, 34, 8, 34, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 34, 8, 34, 8, 34, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 34, 8
+};
+static const uint8_t IR_FRAME_47[] PROGMEM = {  // nec-FFE0E1-zero-high-in
+  180, 90, 11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 34, 13, 34, 13, 34, 13, 34, 13, 34, 13, 34, 13, 34,
+  13, 34, 13, 34, 13, 34, 13, 34, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 34, 13, 34, 13, 34, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 34, 13
+};
+static const uint8_t IR_FRAME_48[] PROGMEM = {  // nec-FFE0E1-zero-high-out
+  180, 90, 11, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34, 14, 34,
+  14, 34, 14, 34, 14, 34, 14, 34, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 14, 14, 34, 14, 34, 14, 34, 14, 14, 14, 14, 14, 14, 14, 14,
+  14, 34, 14
+};
+static const uint8_t IR_FRAME_49[] PROGMEM = {  // nec-FFE0E1-one-low-in
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 26, 11, 26, 11, 26, 11, 26, 11, 26, 11, 26, 11, 26,
+  11, 26, 11, 26, 11, 26, 11, 26, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 26, 11, 26, 11, 26, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 26, 11
+};
+static const uint8_t IR_FRAME_50[] PROGMEM = {  // nec-FFE0E1-one-low-out
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25, 11, 25,
+  11, 25, 11, 25, 11, 25, 11, 25, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 25, 11, 25, 11, 25, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 25, 11
+};
+static const uint8_t IR_FRAME_51[] PROGMEM = {  // nec-FFE0E1-one-high-in
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 41, 11, 41, 11, 41, 11, 41, 11, 41, 11, 41, 11, 41,
+  11, 41, 11, 41, 11, 41, 11, 41, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 41, 11, 41, 11, 41, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 41, 11
+};
+static const uint8_t IR_FRAME_52[] PROGMEM = {  // nec-FFE0E1-one-high-out
+  180, 90, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 42, 11, 42, 11, 42, 11, 42, 11, 42, 11, 42, 11, 42,
+  11, 42, 11, 42, 11, 42, 11, 42, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 11, 11, 42, 11, 42, 11, 42, 11, 11, 11, 11, 11, 11, 11, 11,
+  11, 42, 11
+};
+static const uint8_t IR_FRAME_53[] PROGMEM = {  // nec-repeat-rptspace-low-in
+  180, 34, 11
+};
+static const uint8_t IR_FRAME_54[] PROGMEM = {  // nec-repeat-rptspace-low-out
+  180, 33, 11
+};
+static const uint8_t IR_FRAME_55[] PROGMEM = {  // nec-repeat-rptspace-high-in
+  180, 55, 11
+};
+static const uint8_t IR_FRAME_56[] PROGMEM = {  // nec-repeat-rptspace-high-out
+  180, 56, 11
+};
+
+static const IrCorpusFrame IR_CORPUS[] PROGMEM = {
+  { IR_KIND_CLEAN, 67, 0xFFE0E1UL, IR_FRAME_0 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_1 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_2 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_3 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_4 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_5 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_6 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_7 },
+  { IR_KIND_NOISY, 67, 0xFFE0E1UL, IR_FRAME_8 },
+  { IR_KIND_TRUNCATED, 37, IR_EXPECT_NONE, IR_FRAME_9 },
+  { IR_KIND_TRUNCATED, 15, IR_EXPECT_NONE, IR_FRAME_10 },
+  { IR_KIND_TRUNCATED, 57, IR_EXPECT_NONE, IR_FRAME_11 },
+  { IR_KIND_CLEAN, 67, 0xFF02FDUL, IR_FRAME_12 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_13 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_14 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_15 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_16 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_17 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_18 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_19 },
+  { IR_KIND_NOISY, 67, 0xFF02FDUL, IR_FRAME_20 },
+  { IR_KIND_TRUNCATED, 13, IR_EXPECT_NONE, IR_FRAME_21 },
+  { IR_KIND_TRUNCATED, 29, IR_EXPECT_NONE, IR_FRAME_22 },
+  { IR_KIND_TRUNCATED, 19, IR_EXPECT_NONE, IR_FRAME_23 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_24 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_25 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_26 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_27 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_28 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_29 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_30 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_31 },
+  { IR_KIND_REPEAT, 3, 0xFFFFFFFFUL, IR_FRAME_32 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_33 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_34 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_35 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_36 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_37 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_38 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_39 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_40 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_41 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_42 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_43 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_44 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_45 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_46 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_47 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_48 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_49 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_50 },
+  { IR_KIND_EDGE, 67, 0xFFE0E1UL, IR_FRAME_51 },
+  { IR_KIND_OUTSIDE, 67, IR_EXPECT_NONE, IR_FRAME_52 },
+  { IR_KIND_EDGE, 3, 0xFFFFFFFFUL, IR_FRAME_53 },
+  { IR_KIND_OUTSIDE, 3, IR_EXPECT_NONE, IR_FRAME_54 },
+  { IR_KIND_EDGE, 3, 0xFFFFFFFFUL, IR_FRAME_55 },
+  { IR_KIND_OUTSIDE, 3, IR_EXPECT_NONE, IR_FRAME_56 },
+};
+
+const uint8_t IR_CORPUS_SIZE = sizeof(IR_CORPUS) / sizeof(IR_CORPUS[0]);
+
+#endif  // IRCORPUS_H
@@ -0,0 +1,402 @@
+/**
+ * @file IrBench.cpp
+ * @brief Стенд декодера ІЧ-пульта: корпус кадрів через irrecv.decode() (середовище uno_irbench).
+ *
+ * Опис корпусу та звіту — у IrBench.h. Тут:
+ * - Inject() кладе кадр у буфер приймача IRremote і позначає його
+ *   прийнятим — так само, як це робить переривання наприкінці кадру;
+ * - TimedDecode() вимірює irrecv.decode() таймером Timer1 із заборонами
+ *   переривань (millis() та порт не додають свого часу);
+ * - RepeatStress() проганяє серію «кадр + повтори» з заданим періодом на
+ *   віртуальній шкалі часу: приймач стоїть від кінця кадру до resume(), а
+ *   програма після resume() ще друкує код у порт на 9600 бод; кадри, що
+ *   почалися, поки приймач стоїть, втрачено.
+ *
+ * Звіт виводиться після запуску і повторюється на будь-який символ з порту.
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#include <Arduino.h>
+#include <IRremote.h>
+
+#include "IrBench.h"
+#include "IrCorpus.h"
+
+const int RECV_PIN = 2;                     ///< Пін приймача (не вмикається)
+const unsigned long BENCH_BAUD = 115200;    ///< Швидкість порту стенда
+const unsigned long APP_BAUD = 9600;        ///< Швидкість порту IR_Control (main.cpp)
+const uint8_t APP_TX_BUFFER = 63;           ///< Вільне місце в буфері передачі HardwareSerial
+const unsigned long FRAME_GAP_US = 5000;    ///< Пауза, за якою IRremote фіксує кінець кадру
+const unsigned long REPEAT_FIRST_US = 108000; ///< NEC: перший повтор через 108 мс від початку кадру
+const uint8_t REPEAT_FRAMES = 40;           ///< Повторів у серії
+const uint8_t REPEAT_PERIODS_MS[] = { 108, 72, 54, 36, 27, 20 }; ///< Періоди повторів для серій
+
+IRrecv irrecv(RECV_PIN);  ///< Той самий декодер, що й у програмі
+decode_results results;   ///< Результат декодування
+
+/**
+ * @brief Лічильники одного виду кадрів.
+ */
+struct KindStats
+{
+  uint16_t frames;       ///< Відтворено кадрів
+  uint16_t ok;           ///< Результат збігся з очікуваним
+  uint16_t wrong;        ///< Розпізнано інший код (або кадр, що не мав розпізнаватися)
+  uint16_t missed;       ///< Не розпізнано кадр з очікуваним кодом
+  uint32_t totalCycles;  ///< Сумарні такти decode()
+  uint32_t maxCycles;    ///< Найдовший decode()
+};
+
+/**
+ * @brief Print, що лише рахує байти — довжина рядків, які друкує програма.
+ */
+class CountingPrint : public Print
+{
+public:
+  CountingPrint() : count(0) {}
+  size_t write(uint8_t) { count++; return 1; }
+  uint16_t count;
+};
+
+/**
+ * @brief Модель передавача порту програми: буфер на APP_TX_BUFFER байтів, що
+ *        спорожнюється зі швидкістю APP_BAUD; запис у повний буфер чекає.
+ */
+class VirtualUart
+{
+public:
+  VirtualUart() : _at(0), _queued(0) {}
+
+  /**
+   * @brief Записує bytes байтів у момент now.
+   *
+   * @return Скільки мкс запис чекав на місце в буфері.
+   */
+  uint32_t Write(uint32_t now, uint16_t bytes)
+  {
+    const uint32_t byteUs = 10000000UL / APP_BAUD;  // Старт, 8 бітів, стоп
+    uint32_t drained = (now - _at) / byteUs;
+    if (drained >= _queued)
+    {
+      _queued = 0;
+      _at = now;
+    }
+    else
+    {
+      _queued -= drained;
+      _at += drained * byteUs;
+    }
+
+    _queued += bytes;
+    if (_queued <= APP_TX_BUFFER) return 0;
+    uint32_t wait = (uint32_t)(_queued - APP_TX_BUFFER) * byteUs;
+    _queued = APP_TX_BUFFER;
+    _at += wait;
+    return wait;
+  }
+
+private:
+  uint32_t _at;      ///< Момент, до якого враховано передачу
+  uint16_t _queued;  ///< Байтів у буфері на момент _at
+};
+
+/**
+ * @brief Копія кадру корпусу з PROGMEM.
+ */
+IrCorpusFrame CorpusFrame(uint8_t index)
+{
+  IrCorpusFrame frame;
+  memcpy_P(&frame, &IR_CORPUS[index], sizeof(frame));
+  return frame;
+}
+
+/**
+ * @brief Тривалість кадру, мкс.
+ */
+uint32_t FrameMicros(const IrCorpusFrame &frame)
+{
+  uint32_t ticks = 0;
+  for (uint8_t i = 0; i < frame.length; i++) ticks += pgm_read_byte(frame.ticks + i);
+  return ticks * IR_CORPUS_TICK_US;
+}
+
+/**
+ * @brief Кладе кадр у буфер приймача, як переривання IRremote після паузи FRAME_GAP_US.
+ *
+ * @return false, якщо кадр не вміщується в буфер приймача.
+ */
+bool Inject(const IrCorpusFrame &frame)
+{
+  if (frame.length + 1 > RAW_BUFFER_LENGTH) return false;
+
+  irparams.rawbuf[0] = FRAME_GAP_US / IR_CORPUS_TICK_US;  // Пауза перед кадром
+  for (uint8_t i = 0; i < frame.length; i++)
+  {
+    irparams.rawbuf[i + 1] = pgm_read_byte(frame.ticks + i);
+  }
+  irparams.rawlen = frame.length + 1;
+  irparams.StateForISR = IR_REC_STATE_STOP;  // Кадр готовий до decode()
+  return true;
+}
+
+/**
+ * @brief irrecv.decode() для введеного кадру з вимірюванням тактів, далі resume().
+ *
+ * Timer1 з подільником 8: крок 8 тактів, до 32 мс без переповнення.
+ */
+bool TimedDecode(uint32_t &cycles)
+{
+  uint8_t oldSREG = SREG;
+  cli();
+  TCCR1A = 0;
+  TCCR1B = 0;
+  TCNT1 = 0;
+  TIFR1 = _BV(TOV1);
+  TCCR1B = _BV(CS11);
+
+  bool decoded = irrecv.decode(&results);
+
+  TCCR1B = 0;
+  uint16_t ticks = TCNT1;
+  bool overflow = TIFR1 & _BV(TOV1);
+  SREG = oldSREG;
+
+  cycles = overflow ? 0x80000UL : (uint32_t)ticks * 8;
+  irrecv.resume();
+  return decoded;
+}
+
+const __FlashStringHelper *KindName(uint8_t kind)
+{
+  switch (kind)
+  {
+    case IR_KIND_CLEAN: return F("чисті");
+    case IR_KIND_NOISY: return F("з шумом");
+    case IR_KIND_TRUNCATED: return F("обірвані");
+    case IR_KIND_REPEAT: return F("повтори");
+    case IR_KIND_EDGE: return F("на межі допуску");
+    default: return F("поза допуском");
+  }
+}
+
+/**
+ * @brief Відтворює весь корпус і виводить розпізнавання та такти за видами кадрів.
+ */
+void CorpusPass()
+{
+  KindStats stats[IR_KIND_COUNT];
+  memset(stats, 0, sizeof(stats));
+  uint8_t skipped = 0;
+
+  for (uint8_t i = 0; i < IR_CORPUS_SIZE; i++)
+  {
+    IrCorpusFrame frame = CorpusFrame(i);
+    if (frame.kind >= IR_KIND_COUNT || !Inject(frame))
+    {
+      skipped++;
+      continue;
+    }
+
+    uint32_t cycles;
+    bool decoded = TimedDecode(cycles);
+    KindStats &s = stats[frame.kind];
+    s.frames++;
+    s.totalCycles += cycles;
+    if (cycles > s.maxCycles) s.maxCycles = cycles;
+
+    if (frame.expect == IR_EXPECT_NONE)
+    {
+      if (decoded) s.wrong++;
+      else s.ok++;
+    }
+    else if (!decoded) s.missed++;
+    else if (results.value == frame.expect) s.ok++;
+    else s.wrong++;
+  }
+
+  Serial.print(F("[IR] корпус: "));
+  Serial.print(IR_CORPUS_SIZE);
+  Serial.println(F(" кадрів"));
+  Serial.println(F("[IR] вид: кадрів, як очікувалося / інший код / не розпізнано, такти decode() сер. / макс."));
+
+  uint16_t frames = 0, ok = 0;
+  for (uint8_t k = 0; k < IR_KIND_COUNT; k++)
+  {
+    const KindStats &s = stats[k];
+    if (s.frames == 0) continue;
+    frames += s.frames;
+    ok += s.ok;
+
+    Serial.print(F("  "));
+    Serial.print(KindName(k));
+    Serial.print(F(": "));
+    Serial.print(s.frames);
+    Serial.print(F(", "));
+    Serial.print(s.ok);
+    Serial.print(F(" / "));
+    Serial.print(s.wrong);
+    Serial.print(F(" / "));
+    Serial.print(s.missed);
+    Serial.print(F(", "));
+    Serial.print(s.totalCycles / s.frames);
+    Serial.print(F(" / "));
+    Serial.println(s.maxCycles);
+  }
+
+  Serial.print(F("[IR] успішно: "));
+  Serial.print(ok);
+  Serial.print(F(" з "));
+  Serial.print(frames);
+  if (frames > 0)
+  {
+    Serial.print(F(" ("));
+    Serial.print(100UL * ok / frames);
+    Serial.print(F("%)"));
+  }
+  if (skipped > 0)
+  {
+    Serial.print(F(", пропущено (не вміщуються в буфер): "));
+    Serial.print(skipped);
+  }
+  Serial.println();
+}
+
+/**
+ * @brief Байтів, які IR_Control друкує на кадр у режимі моніторингу.
+ *
+ * Ті самі рядки, що в IrSource::Poll() та KeyDecoder::Process() (main.cpp).
+ */
+uint16_t MonitorPrintBytes(uint32_t code)
+{
+  CountingPrint out;
+  out.print("Код кнопки: 0x");
+  out.println(code, HEX);
+  out.println("Режим моніторингу: кнопка прийнята.\n");
+  return out.count;
+}
+
+/**
+ * @brief Серія «кадр + REPEAT_FRAMES повторів» з періодом periodMs.
+ *
+ * Приймач зайнятий від початку прийнятого кадру до resume() після його
+ * декодування; decode() починається, коли кадр закінчився паузою
+ * FRAME_GAP_US і програма дописала в порт попередній код. Кадр, що
+ * почався, поки приймач зайнятий, втрачено.
+ */
+void RepeatStress(uint8_t periodMs, const IrCorpusFrame &full, const IrCorpusFrame &repeat)
+{
+  const uint32_t cyclesPerUs = F_CPU / 1000000UL;
+  VirtualUart uart;
+  uint32_t receiverFree = 0;  // resume() після останнього прийнятого кадру
+  uint32_t appFree = 0;       // Програма дописала код у порт
+  uint32_t worstDecode = 0;
+  uint8_t received = 0, decoded = 0;
+
+  for (uint8_t n = 0; n <= REPEAT_FRAMES; n++)
+  {
+    const IrCorpusFrame &frame = (n == 0) ? full : repeat;
+    uint32_t start = (n == 0) ? 0 : REPEAT_FIRST_US + (uint32_t)(n - 1) * periodMs * 1000UL;
+    if (start < receiverFree) continue;  // Приймач ще не відновлено — кадр втрачено
+    received++;
+
+    uint32_t cycles = 0;
+    bool ok = Inject(frame) && TimedDecode(cycles) && results.value == frame.expect;
+    if (ok) decoded++;
+    if (cycles > worstDecode) worstDecode = cycles;
+
+    uint32_t end = start + FrameMicros(frame) + FRAME_GAP_US;
+    uint32_t decodeAt = (end > appFree) ? end : appFree;
+    receiverFree = decodeAt + cycles / cyclesPerUs;
+    appFree = receiverFree + uart.Write(receiverFree, MonitorPrintBytes(frame.expect));
+  }
+
+  Serial.print(F("  період "));
+  Serial.print(periodMs);
+  Serial.print(F(" мс: прийнято "));
+  Serial.print(received);
+  Serial.print(F(" з "));
+  Serial.print(REPEAT_FRAMES + 1);
+  Serial.print(F(", втрачено "));
+  Serial.print(REPEAT_FRAMES + 1 - received);
+  Serial.print(F(", розпізнано "));
+  Serial.print(decoded);
+  Serial.print(F(", decode() до "));
+  Serial.print(worstDecode);
+  Serial.println(F(" тактів"));
+}
+
+/**
+ * @brief Серії повторів для всіх REPEAT_PERIODS_MS на першому чистому кадрі й першому повторі корпусу.
+ */
+void RepeatPass()
+{
+  uint8_t fullIndex = 0, repeatIndex = 0;
+  bool haveFull = false, haveRepeat = false;
+  for (uint8_t i = 0; i < IR_CORPUS_SIZE; i++)
+  {
+    IrCorpusFrame frame = CorpusFrame(i);
+    if (frame.kind == IR_KIND_CLEAN && !haveFull)
+    {
+      fullIndex = i;
+      haveFull = true;
+    }
+    if (frame.kind == IR_KIND_REPEAT && !haveRepeat)
+    {
+      repeatIndex = i;
+      haveRepeat = true;
+    }
+  }
+  if (!haveFull || !haveRepeat)
+  {
+    Serial.println(F("[IR] повтори: у корпусі немає чистого кадру або кадру повтору."));
+    return;
+  }
+
+  IrCorpusFrame full = CorpusFrame(fullIndex);
+  IrCorpusFrame repeat = CorpusFrame(repeatIndex);
+
+  Serial.print(F("[IR] повтори: кадр + "));
+  Serial.print(REPEAT_FRAMES);
+  Serial.print(F(" повторів, режим моніторингу, порт "));
+  Serial.print(APP_BAUD);
+  Serial.print(F(" бод ("));
+  Serial.print(MonitorPrintBytes(repeat.expect));
+  Serial.println(F(" байтів на повтор)"));
+  for (uint8_t i = 0; i < sizeof(REPEAT_PERIODS_MS); i++)
+  {
+    RepeatStress(REPEAT_PERIODS_MS[i], full, repeat);
+  }
+}
+
+void RunBench()
+{
+  CorpusPass();
+  RepeatPass();
+  Serial.println(F("[IR] Надішліть будь-який символ, щоб повторити."));
+}
+
+void setup()
+{
+  Serial.begin(BENCH_BAUD);
+
+  // Перший decode() поза вимірюванням: ініціалізація декодера не входить у такти
+  if (IR_CORPUS_SIZE > 0 && Inject(CorpusFrame(0)))
+  {
+    irrecv.decode(&results);
+    irrecv.resume();
+  }
+
+  RunBench();
+}
+
+void loop()
+{
+  if (Serial.available())
+  {
+    while (Serial.available()) Serial.read();
+    RunBench();
+  }
+}
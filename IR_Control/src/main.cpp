@@ -23,7 +23,19 @@
  *
  * --- Необхідні бібліотеки ---
  *  - <IRremote.h> (прийом сигналів пульта)
- *  - <Servo.h>    (керування сервоприводом)
+ *  - <ServoBank.h> (керування сервоприводом, спільна бібліотека з lib/)
+ *  - <Idle.h>      (сон між подіями, спільна бібліотека з lib/)
+ *  - <Gauge.h>     (рядок зі шкалою кута, спільна бібліотека з lib/)
+ *  - <StateJournal.h> (збереження режиму, кута і LED в EEPROM, спільна бібліотека з lib/)
+ *  - <MemDiag.h>   (звіт про SRAM за командою 'm', спільна бібліотека з lib/)
+ *  - <Pipeline.h>  (конвеєр етапів, звіт за командою 't', спільна бібліотека з lib/)
+ *
+ * Режим, кут сервоприводу і стан світлодіода переживають вимкнення живлення:
+ * вони відновлюються з EEPROM на самому початку setup(), ще до першого
+ * імпульсу сервоприводу.
+ *
+ * Команди пульта проходять конвеєр lib/Pipeline: приймач → розпізнавання
+ * кнопки → світлодіод (режим 1) → планувальник кута → сервопривід → шкала.
  *
  * @author  Дмитро Агеєв
  * @date    09.10.2025
@@ -32,7 +44,12 @@
 
 #include <Arduino.h>
 #include <IRremote.h>
-#include <Servo.h>
+#include <ServoBank.h>
+#include <Idle.h>
+#include <Gauge.h>
+#include <StateJournal.h>
+#include <MemDiag.h>
+#include <Pipeline.h>
 
 // ----------------------------------------------------------
 //                    Константи та змінні
@@ -40,30 +57,134 @@
 
 const int RECV_PIN = 2;   ///< Пін приймача ІЧ-пульта
 const int LED_PIN = 13;   ///< Вбудований світлодіод
-const int SERVO_PIN = 9;  ///< Пін сервоприводу
+const int SERVO_PIN = 9;  ///< Пін сервоприводу (OC1A — апаратний канал без тремтіння)
 const int ANGLE_STEP = 3; ///< Крок зміни кута сервоприводу
+const unsigned long IDLE_TICK_MS = 100; ///< Найдовший сон без подій
+const unsigned long JOURNAL_TICK_MS = 5; ///< Сон, поки журнал переносить стан в EEPROM
+
+/**
+ * @brief Оформлення рядка з кутом: 20 поділок по 9°.
+ */
+const GaugeStyle ANGLE_GAUGE = { "Поточний кут сервоприводу: ", "°  ", 20, '#', '-', false };
 
 IRrecv irrecv(RECV_PIN);  ///< Об’єкт приймача ІЧ-сигналів
 decode_results results;   ///< Збереження прийнятого коду
-Servo myServo;            ///< Об’єкт сервоприводу
+ServoBank servos;         ///< Драйвер сервоприводів на Timer1
+int8_t servoChannel = -1; ///< Канал сервоприводу в ServoBank
 
 int menuMode = 0;         ///< Поточний режим (0 – моніторинг, 1 – LED, 2 – серво)
 int servoAngle = 90;      ///< Поточний кут сервоприводу
+bool ledOn = false;       ///< Стан світлодіода
+
+/**
+ * @brief Стан, що зберігається в EEPROM між вмиканнями.
+ */
+struct PersistentState {
+  uint8_t angle;          ///< Кут сервоприводу
+  uint8_t mode;           ///< Режим меню
+  uint8_t led;            ///< Світлодіод увімкнено
+};
+
+StateJournal journal(0, 512, sizeof(PersistentState)); ///< Журнал стану (перші 512 байтів EEPROM)
 
 // ----------------------------------------------------------
 //                   ПРОТОТИПИ ФУНКЦІЙ
 // ----------------------------------------------------------
 void PrintMenu();
 void HandleSerialInput();
-void HandleIRInput();
-void HandleLEDControl(unsigned long code);
-void HandleServoControl(unsigned long code);
 void PrintAngleChange(int angle);
+bool IrFrameReady();
+bool RestoreState();
+void SaveState();
+
+// ----------------------------------------------------------
+//                    ЕТАПИ КОНВЕЄРА
+// ----------------------------------------------------------
+/**
+ * @brief Кнопки пульта, що мають дію в режимах керування.
+ */
+enum RemoteKey {
+  KEY_STAR,   ///< "*" (0xFFE0E1)
+  KEY_HASH    ///< "#" (0xFF02FD)
+};
+
+/**
+ * @brief Джерело: прийнятий код ІЧ-пульта (виводиться у порт).
+ */
+struct IrSource {
+  typedef unsigned long Output;
+  bool Poll(unsigned long &code);
+  const __FlashStringHelper *Name() const { return F("ir"); }
+};
+
+/**
+ * @brief Фільтр: код → кнопка з урахуванням режиму меню.
+ *
+ * У режимі моніторингу, на повтор і на невідомі кнопки значення далі
+ * не йде.
+ */
+struct KeyDecoder {
+  typedef RemoteKey Output;
+  bool Process(const unsigned long &code, RemoteKey &key);
+  const __FlashStringHelper *Name() const { return F("key"); }
+};
+
+/**
+ * @brief Виконавчий пристрій режиму 1: світлодіод. В інших режимах пропускає кнопку далі.
+ */
+struct LedActuator {
+  typedef RemoteKey Output;
+  bool Process(const RemoteKey &key, RemoteKey &out);
+  const __FlashStringHelper *Name() const { return F("led"); }
+};
+
+/**
+ * @brief Планувальник режиму 2: кнопка → новий кут з кроком ANGLE_STEP у межах 0–180°.
+ */
+struct AnglePlanner {
+  typedef int Output;
+  bool Process(const RemoteKey &key, int &angle);
+  const __FlashStringHelper *Name() const { return F("planner"); }
+};
+
+/**
+ * @brief Виконавчий пристрій: сервопривід, кут зберігається в журналі.
+ */
+struct ServoActuator {
+  typedef int Output;
+  bool Process(const int &angle, int &out);
+  const __FlashStringHelper *Name() const { return F("servo"); }
+};
+
+/**
+ * @brief Вивід кута зі шкалою.
+ */
+struct AngleDisplay {
+  typedef int Output;
+  bool Process(const int &angle, int &out);
+  const __FlashStringHelper *Name() const { return F("gauge"); }
+};
+
+IrSource irSource;
+KeyDecoder keyDecoder;
+LedActuator ledActuator;
+AnglePlanner anglePlanner;
+ServoActuator servoActuator;
+AngleDisplay angleDisplay;
+
+/**
+ * @brief Конвеєр команд пульта.
+ */
+Pipeline<IrSource, KeyDecoder, LedActuator, AnglePlanner, ServoActuator, AngleDisplay>
+  pipeline(irSource, keyDecoder, ledActuator, anglePlanner, servoActuator, angleDisplay);
 
 // ----------------------------------------------------------
 //                         SETUP()
 // ----------------------------------------------------------
 void setup() {
+  // Стан відновлюється першим: кут потрібен до першого імпульсу сервоприводу
+  bool restored = RestoreState();
+
   Serial.begin(9600);
   Serial.println("====================================================");
   Serial.println("📡 Система керування через ІЧ-пульт і Serial Monitor");
@@ -72,16 +193,21 @@ void setup() {
   Serial.println(">  Ініціалізація пристроїв: ");
   
   irrecv.enableIRIn();
+  IdleWakeOnPin(RECV_PIN);   // Фронт ІЧ-сигналу будить ядро
+  IdleWakeOnSerial(Serial);  // Байт з терміналу будить ядро
   pinMode(LED_PIN, OUTPUT);
+  digitalWrite(LED_PIN, ledOn ? HIGH : LOW);
   Serial.println("[+]  Ініціалізація вбудованого світлодіоду ");
   Serial.println("[+]  Ініціалізація IR-приймача ");
-  if (myServo.attach(SERVO_PIN))
+  servoChannel = servos.Attach(SERVO_PIN, servoAngle);
+  if (servoChannel >= 0)
   {
     Serial.println("[+]  Ініціалізація сервоприводу ");
-    myServo.write(servoAngle);
   }
   else Serial.println("[-]  Ініціалізація сервоприводу ");
+  if (restored) Serial.println("[+]  Стан відновлено з EEPROM ");
   Serial.println();
+  MemDiagReport(Serial, F("після setup()"));
   PrintMenu();
 }
 
@@ -90,7 +216,47 @@ void setup() {
 // ----------------------------------------------------------
 void loop() {
   HandleSerialInput(); // Обробка вводу з терміналу
-  HandleIRInput();     // Обробка команд із пульта
+  pipeline.Run();      // Обробка команд із пульта
+  journal.Service();   // Відкладений запис стану, без очікування EEPROM
+
+  // Сон до наступної події замість безперервного опитування
+  IdleUntil(millis() + (journal.Pending() ? JOURNAL_TICK_MS : IDLE_TICK_MS), IrFrameReady);
+}
+
+// ----------------------------------------------------------
+//                 ЗБЕРЕЖЕННЯ СТАНУ В EEPROM
+// ----------------------------------------------------------
+/**
+ * @brief Відновлює режим, кут і світлодіод з останнього запису журналу.
+ *
+ * @return false, якщо запису немає (залишаються значення за замовчуванням).
+ */
+bool RestoreState() {
+  PersistentState state;
+  if (!journal.Begin(&state)) return false;
+
+  servoAngle = constrain(state.angle, 0, 180);
+  menuMode = (state.mode <= 2) ? state.mode : 0;
+  ledOn = state.led != 0;
+  return true;
+}
+
+/**
+ * @brief Передає поточний стан журналу; в EEPROM він потрапить пізніше.
+ */
+void SaveState() {
+  PersistentState state = { (uint8_t)servoAngle, (uint8_t)menuMode, (uint8_t)ledOn };
+  journal.Save(&state);
+}
+
+/**
+ * @brief Чи прийнято повний ІЧ-кадр (умова пробудження для IdleUntil).
+ *
+ * Кінець кадру визначає таймер IRremote за паузою, без фронту на піні,
+ * тому окремої перевірки фронтів недостатньо.
+ */
+bool IrFrameReady() {
+  return irrecv.available();
 }
 
 // ----------------------------------------------------------
@@ -103,6 +269,9 @@ void loop() {
  * - 0 — Моніторинг кнопок пульта
  * - 1 — Керування світлодіодом
  * - 2 — Керування сервоприводом
+ *
+ * Команда m виводить звіт про пам’ять, t — звіт про етапи конвеєра;
+ * режим при цьому не змінюється.
  */
 void HandleSerialInput() {
   if (Serial.available()) {
@@ -111,10 +280,17 @@ void HandleSerialInput() {
       case '0': menuMode = 0; break;
       case '1': menuMode = 1; break;
       case '2': menuMode = 2; break;
+      case 'm':
+        MemDiagReport(Serial, F("за запитом"));
+        return;
+      case 't':
+        pipeline.Report(Serial);
+        return;
       default:
         Serial.println("❌ Невідомий вибір. Введіть 0, 1 або 2.");
         return;
     }
+    SaveState();
     PrintMenu();
   }
 }
@@ -123,33 +299,40 @@ void HandleSerialInput() {
 //                 ОБРОБКА СИГНАЛІВ З ПУЛЬТА
 // ----------------------------------------------------------
 /**
- * @brief Обробляє команди з ІЧ-пульта в залежності від поточного режиму.
+ * @brief Забирає прийнятий код і одразу готує приймач до наступного.
  *
  * Усі прийняті коди виводяться у Serial Monitor у шістнадцятковому форматі.
- * Відповідна функція обробки викликається залежно від активного режиму меню.
- */
-void HandleIRInput() {
-  if (irrecv.decode(&results)) {
-    unsigned long code = results.value;
-
-    // Вивід коду кнопки
-    Serial.print("Код кнопки: 0x");
-    Serial.println(code, HEX);
-
-    switch (menuMode) {
-      case 0:
-        Serial.println("Режим моніторингу: кнопка прийнята.\n");
-        break;
-      case 1:
-        HandleLEDControl(code);
-        break;
-      case 2:
-        HandleServoControl(code);
-        break;
-    }
+ */
+bool IrSource::Poll(unsigned long &code) {
+  if (!irrecv.decode(&results)) return false;
+
+  code = results.value;
+  irrecv.resume(); // Готуватися до прийому наступного сигналу
+
+  // Вивід коду кнопки
+  Serial.print("Код кнопки: 0x");
+  Serial.println(code, HEX);
+  return true;
+}
 
-    irrecv.resume(); // Готуватися до прийому наступного сигналу
+/**
+ * @brief Розпізнає кнопку відповідно до поточного режиму.
+ */
+bool KeyDecoder::Process(const unsigned long &code, RemoteKey &key) {
+  if (menuMode == 0) {
+    Serial.println("Режим моніторингу: кнопка прийнята.\n");
+    return false;
+  }
+
+  switch (code) {
+    case 0xFFFFFFFF: return false; // Повтор — пропускаємо
+    case 0xFFE0E1: key = KEY_STAR; return true;  // Код кнопки "*"
+    case 0xFF02FD: key = KEY_HASH; return true;  // Код кнопки "#"
   }
+
+  if (menuMode == 1) Serial.println("Невідома кнопка у режимі LED.");
+  else Serial.println("Невідома кнопка у режимі серво.");
+  return false;
 }
 
 // ----------------------------------------------------------
@@ -163,6 +346,8 @@ void PrintMenu() {
   Serial.println("0 - Режим моніторингу кнопок");
   Serial.println("1 - Керування світлодіодом");
   Serial.println("2 - Керування сервоприводом");
+  Serial.println("m - Звіт про пам'ять");
+  Serial.println("t - Час етапів обробки команд");
   Serial.print("Поточний режим: ");
   switch (menuMode) {
     case 0: Serial.println("Моніторинг кнопок"); break;
@@ -181,49 +366,52 @@ void PrintMenu() {
  * Кнопка '*' — вмикає світлодіод.
  * Кнопка '#' — вимикає світлодіод.
  */
-void HandleLEDControl(unsigned long code) {
-  switch (code) {
-    case 0xFFFFFFFF: break; // Повтор — пропускаємо
-    case 0xFFE0E1:   // Код кнопки "*"
-      digitalWrite(LED_PIN, HIGH);
-      Serial.println("💡 Світлодіод УВІМКНЕНО\n");
-      break;
-    case 0xFF02FD:   // Код кнопки "#"
-      digitalWrite(LED_PIN, LOW);
-      Serial.println("💡 Світлодіод ВИМКНЕНО\n");
-      break;
-    default:
-      Serial.println("Невідома кнопка у режимі LED.");
+bool LedActuator::Process(const RemoteKey &key, RemoteKey &out) {
+  if (menuMode != 1) {
+    out = key;
+    return true;
   }
+
+  ledOn = (key == KEY_STAR);
+  digitalWrite(LED_PIN, ledOn ? HIGH : LOW);
+  SaveState();
+  Serial.println(ledOn ? "💡 Світлодіод УВІМКНЕНО\n" : "💡 Світлодіод ВИМКНЕНО\n");
+  return false; // Команду виконано, серво її не стосується
 }
 
 // ----------------------------------------------------------
 //               КЕРУВАННЯ СЕРВОПРИВОДОМ
 // ----------------------------------------------------------
 /**
- * @brief Обробляє натискання кнопок пульта у режимі керування сервоприводом.
+ * @brief Обчислює новий кут у режимі керування сервоприводом.
  *
  * Кнопка '*' — зменшує кут на 3°.
  * Кнопка '#' — збільшує кут на 3°.
  */
-void HandleServoControl(unsigned long code) {
-  switch (code) {
-    case 0xFFFFFFFF: break;
-    case 0xFFE0E1:   // "*"
-      servoAngle -= ANGLE_STEP;
-      if (servoAngle < 0) servoAngle = 0;
-      myServo.write(servoAngle);
-      PrintAngleChange(servoAngle);
-      break;
-    case 0xFF02FD:   // "#"
-      servoAngle += ANGLE_STEP;
-      if (servoAngle > 180) servoAngle = 180;
-      myServo.write(servoAngle);
-      PrintAngleChange(servoAngle);
-      break;
-    default:
-      Serial.println("Невідома кнопка у режимі серво.");
-  }
+bool AnglePlanner::Process(const RemoteKey &key, int &angle) {
+  angle = servoAngle + (key == KEY_STAR ? -ANGLE_STEP : ANGLE_STEP);
+  angle = constrain(angle, 0, 180);
+  return true;
+}
+
+/**
+ * @brief Повертає сервопривід на запланований кут і зберігає його.
+ */
+bool ServoActuator::Process(const int &angle, int &out) {
+  servoAngle = angle;
+  servos.Write(servoChannel, servoAngle);
+  SaveState();
+  out = angle;
+  return true;
+}
+
+/**
+ * @brief Виводить новий кут зі шкалою.
+ */
+bool AngleDisplay::Process(const int &angle, int &out) {
+  PrintAngleChange(angle);
+  out = angle;
+  return true;
 }
 
 // ----------------------------------------------------------
@@ -234,14 +422,11 @@ void HandleServoControl(unsigned long code) {
  * @param angle Поточний кут сервоприводу.
  */
 void PrintAngleChange(int angle) {
-  Serial.print("Поточний кут сервоприводу: ");
-  Serial.print(angle);
-  Serial.print("°  [");
-
-  int filled = map(angle, 0, 180, 0, 20);
-  for (int i = 0; i < 20; i++) {
-    if (i < filled) Serial.print("#");
-    else Serial.print("-");
-  }
-  Serial.println("]\n");
+  char line[GAUGE_LINE_MAX];
+  size_t len = GaugeFormat(line, sizeof(line), ANGLE_GAUGE, angle, 0, 180);
+
+  // Ті самі байти, що й до Gauge (println("]\n")): "]\n", потім "\r\n"
+  line[len - 2] = '\n';
+  Serial.write((const uint8_t *)line, len - 1);
+  Serial.println();
 }
@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+"""
+Корпус сирих ІЧ-кадрів (тривалості імпульсів і пауз) для перевірки декодування IR_Control.
+
+Формат корпусу — текст, один кадр на рядок:
+    <назва> <вид> <очікуваний код|none> <мкс> <мкс> ...
+Тривалості чергуються «імпульс, пауза, імпульс, …» і починаються з
+імпульсу. Вид — clean, noisy, truncated, repeat, edge (тривалості на
+межі допуску декодера) або outside (поза допуском); очікуваний код —
+results.value, який має повернути декодер (повтор NEC — 0xFFFFFFFF),
+або none, якщо кадр не повинен розпізнаватися. Рядки з # — коментарі.
+
+Команди:
+    generate  — синтетичні кадри NEC для кнопок пульта: чисті, з
+                тремтінням і зсувом фронтів приймача, обірвані, повтори
+                та кадри на межах допуску; кадри з шумом, які еталонний
+                декодер не приймає, стають видом outside з міткою none;
+    import    — додає кадри з дампу IRremote (uint16_t rawData[N] = {...});
+    check     — розбирає корпус еталонним декодером NEC з допусками
+                IRremote (±25 %), щоб перевірити мітки без плати;
+    header    — генерує include/IrCorpus.h для середовища uno_irbench
+                (тики по 50 мкс, PROGMEM); тривалість — до 12,75 мс,
+                кадрів і тривалостей у кадрі — до 255.
+
+Приклади:
+    python tools/ir_corpus.py generate --out corpus/remote.ircorpus
+    python tools/ir_corpus.py import dump.txt --kind clean --expect 0xFFE0E1 --out corpus/remote.ircorpus
+    python tools/ir_corpus.py check corpus/remote.ircorpus
+    python tools/ir_corpus.py header corpus/remote.ircorpus --out include/IrCorpus.h
+"""
+
+import argparse
+import random
+import re
+import sys
+
+KINDS = ("clean", "noisy", "truncated", "repeat", "edge", "outside")
+REPEAT_CODE = 0xFFFFFFFF
+MICROS_PER_TICK = 50        # Крок таймера приймача IRremote
+TOLERANCE = 0.25            # Допуск IRremote на тривалість
+MARK_EXCESS = 20            # Поправка IRremote на подовження імпульсів приймачем
+
+# NEC: заголовок, біти (імпульс + пауза), стоп-імпульс; повтор — окремий короткий кадр
+NEC_HEADER_MARK = 9000
+NEC_HEADER_SPACE = 4500
+NEC_REPEAT_SPACE = 2250
+NEC_BIT_MARK = 560
+NEC_ONE_SPACE = 1690
+NEC_ZERO_SPACE = 560
+NEC_BITS = 32
+
+# Кнопки пульта, на які реагує IR_Control ("*" і "#")
+REMOTE_CODES = (0xFFE0E1, 0xFF02FD)
+
+
+class Frame:
+    def __init__(self, name, kind, expect, timings):
+        self.name = name
+        self.kind = kind
+        self.expect = expect        # Код або None
+        self.timings = timings      # мкс, імпульс першим
+
+    def line(self):
+        expect = "none" if self.expect is None else "0x%X" % self.expect
+        return "%s %s %s %s" % (self.name, self.kind, expect, " ".join(str(t) for t in self.timings))
+
+
+def load(path):
+    frames = []
+    with open(path, encoding="utf-8") as f:
+        for number, raw in enumerate(f, 1):
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            if len(parts) < 4 or parts[1] not in KINDS:
+                sys.exit("%s:%d: очікується «назва вид код мкс…»" % (path, number))
+            expect = None if parts[2] == "none" else int(parts[2], 16)
+            frames.append(Frame(parts[0], parts[1], expect, [int(t) for t in parts[3:]]))
+    return frames
+
+
+def save(path, frames, append):
+    with open(path, "a" if append else "w", encoding="utf-8") as f:
+        if not append:
+            f.write("# Корпус ІЧ-кадрів IR_Control: назва вид код|none мкс… (імпульс першим)\n")
+        for frame in frames:
+            f.write(frame.line() + "\n")
+
+
+# --- генерація -------------------------------------------------------------
+
+def nec_frame(code, msb_first=True):
+    bits = [(code >> (NEC_BITS - 1 - i)) & 1 for i in range(NEC_BITS)]
+    if not msb_first:
+        bits.reverse()
+    timings = [NEC_HEADER_MARK, NEC_HEADER_SPACE]
+    for bit in bits:
+        timings += [NEC_BIT_MARK, NEC_ONE_SPACE if bit else NEC_ZERO_SPACE]
+    timings.append(NEC_BIT_MARK)
+    return timings
+
+
+def nec_repeat():
+    return [NEC_HEADER_MARK, NEC_REPEAT_SPACE, NEC_BIT_MARK]
+
+
+def distort(timings, rng, jitter, drift, excess):
+    """Кадр, яким його бачить реальний приймач TSOP.
+
+    Увесь кадр розтягнуто або стиснуто на drift (розкид генератора пульта),
+    кожен фронт тремтить зі СКВ jitter мкс, а імпульси подовжені на excess
+    мкс за рахунок паузи після них (затримка спаду на виході приймача).
+    Тривалості не обмежуються допуском декодера — мітку кадру визначає
+    еталонний декодер (див. generate()).
+    """
+    scale = 1 + rng.uniform(-drift, drift)
+    out = []
+    for i, t in enumerate(timings):
+        shift = excess if i % 2 == 0 else -excess
+        out.append(max(MICROS_PER_TICK, int(round(t * scale + rng.gauss(0, jitter) + shift))))
+    return out
+
+
+def window(nominal, excess):
+    """Найменша й найбільша тривалість у тиках, яку match() прийме за nominal."""
+    target = nominal + excess
+    low = -(-target * 3 // 200)     # ceil(target * (1 - TOLERANCE) / MICROS_PER_TICK)
+    high = target * 5 // 200        # floor(target * (1 + TOLERANCE) / MICROS_PER_TICK)
+    return low, high
+
+
+# Межі допуску: назва, кадр, які тривалості замінюються, номінал і поправка IRremote
+EDGE_TIMINGS = (
+    ("hdrmark", False, lambda i, t: i == 0, NEC_HEADER_MARK, MARK_EXCESS),
+    ("hdrspace", False, lambda i, t: i == 1, NEC_HEADER_SPACE, -MARK_EXCESS),
+    ("mark", False, lambda i, t: i >= 2 and i % 2 == 0, NEC_BIT_MARK, MARK_EXCESS),
+    ("zero", False, lambda i, t: i >= 3 and t == NEC_ZERO_SPACE, NEC_ZERO_SPACE, -MARK_EXCESS),
+    ("one", False, lambda i, t: i >= 3 and t == NEC_ONE_SPACE, NEC_ONE_SPACE, -MARK_EXCESS),
+    ("rptspace", True, lambda i, t: i == 1, NEC_REPEAT_SPACE, -MARK_EXCESS),
+)
+
+
+def edge_frames(code, msb_first):
+    """Кадри з тривалостями одразу всередині й одразу поза допуском декодера.
+
+    Для кожного виду тривалості (імпульс і пауза заголовка, імпульс біта,
+    пауза 0 і 1, пауза повтору) всі такі тривалості кадру ставляться на
+    нижню чи верхню межу вікна match() або на тик за нею. Кадр усередині
+    має розпізнаватися (вид edge), кадр поза межею — ні (вид outside).
+    """
+    frames = []
+    for name, repeat, pick, nominal, excess in EDGE_TIMINGS:
+        low, high = window(nominal, excess)
+        base = nec_repeat() if repeat else nec_frame(code, msb_first)
+        expect = REPEAT_CODE if repeat else code
+        tag = "repeat" if repeat else "%06X" % code
+        for side, inside, outside in (("low", low, low - 1), ("high", high, high + 1)):
+            for where, t, kind, label in (("in", inside, "edge", expect), ("out", outside, "outside", None)):
+                timings = [t * MICROS_PER_TICK if pick(i, us) else us for i, us in enumerate(base)]
+                frames.append(Frame("nec-%s-%s-%s-%s" % (tag, name, side, where), kind, label, timings))
+    return frames
+
+
+def generate(args):
+    rng = random.Random(args.seed)
+    msb = args.bit_order == "msb"
+    frames = []
+
+    def noisy(name, kind, code, timings):
+        # Мітка — те, що прийме еталонний декодер: шум не підганяється під допуск
+        got = decode_nec(timings, msb)
+        if got == code:
+            frames.append(Frame(name, kind, code, timings))
+        else:
+            frames.append(Frame(name, "outside", got, timings))
+
+    for code in REMOTE_CODES:
+        tag = "%06X" % code
+        frames.append(Frame("nec-%s-clean" % tag, "clean", code, nec_frame(code, msb)))
+        for n in range(args.noisy):
+            timings = distort(nec_frame(code, msb), rng, args.jitter, args.drift, rng.randint(0, args.excess))
+            noisy("nec-%s-noisy%d" % (tag, n), "noisy", code, timings)
+        for n in range(args.truncated):
+            # Обрив посеред даних: кадр закінчується імпульсом після випадкового біта
+            full = nec_frame(code, msb)
+            keep = 2 + 2 * rng.randint(4, NEC_BITS - 2) + 1
+            frames.append(Frame("nec-%s-cut%d" % (tag, n), "truncated", None, full[:keep]))
+    frames.append(Frame("nec-repeat-clean", "repeat", REPEAT_CODE, nec_repeat()))
+    for n in range(args.noisy):
+        timings = distort(nec_repeat(), rng, args.jitter, args.drift, rng.randint(0, args.excess))
+        noisy("nec-repeat-noisy%d" % n, "repeat", REPEAT_CODE, timings)
+
+    edges = edge_frames(REMOTE_CODES[0], msb)
+    for frame in edges:
+        if decode_nec(frame.timings, msb) != frame.expect:
+            sys.exit("%s: межа допуску не збігається з еталонним декодером" % frame.name)
+    frames += edges
+
+    save(args.out, frames, append=False)
+    counts = ", ".join("%s %d" % (k, sum(1 for f in frames if f.kind == k)) for k in KINDS)
+    print("Записано %d кадрів у %s (%s)" % (len(frames), args.out, counts))
+
+
+# --- імпорт ----------------------------------------------------------------
+
+RAW_RE = re.compile(r"rawData\[\d*\]\s*=\s*\{([^}]*)\}")
+
+
+def import_dump(args):
+    with open(args.dump, encoding="utf-8") as f:
+        text = f.read()
+    dumps = RAW_RE.findall(text)
+    if not dumps:
+        sys.exit("У %s немає масивів rawData[] = {...}" % args.dump)
+    expect = None if args.expect == "none" else int(args.expect, 16)
+    frames = []
+    for n, body in enumerate(dumps):
+        timings = [int(t) for t in re.findall(r"\d+", body)]
+        frames.append(Frame("%s%d" % (args.name, n), args.kind, expect, timings))
+    save(args.out, frames, append=True)
+    print("Додано %d кадрів у %s" % (len(frames), args.out))
+
+
+# --- еталонний декодер -----------------------------------------------------
+
+def ticks(us):
+    return max(1, int(round(us / float(MICROS_PER_TICK))))
+
+
+def match(measured_ticks, nominal_us, excess):
+    us = measured_ticks * MICROS_PER_TICK
+    target = nominal_us + excess
+    return target * (1 - TOLERANCE) <= us <= target * (1 + TOLERANCE)
+
+
+def decode_nec(timings, msb_first=True):
+    """Декодує кадр так само, як NEC-декодер IRremote: код, REPEAT_CODE або None."""
+    t = [ticks(us) for us in timings]
+    if len(t) == 3 and match(t[0], NEC_HEADER_MARK, MARK_EXCESS) \
+            and match(t[1], NEC_REPEAT_SPACE, -MARK_EXCESS) and match(t[2], NEC_BIT_MARK, MARK_EXCESS):
+        return REPEAT_CODE
+    if len(t) != 2 * NEC_BITS + 3:
+        return None
+    if not (match(t[0], NEC_HEADER_MARK, MARK_EXCESS) and match(t[1], NEC_HEADER_SPACE, -MARK_EXCESS)):
+        return None
+    value = 0
+    for i in range(NEC_BITS):
+        mark, space = t[2 + 2 * i], t[3 + 2 * i]
+        if not match(mark, NEC_BIT_MARK, MARK_EXCESS):
+            return None
+        if match(space, NEC_ONE_SPACE, -MARK_EXCESS):
+            bit = 1
+        elif match(space, NEC_ZERO_SPACE, -MARK_EXCESS):
+            bit = 0
+        else:
+            return None
+        if msb_first:
+            value = (value << 1) | bit
+        else:
+            value |= bit << i
+    return value
+
+
+def check(args):
+    frames = load(args.corpus)
+    msb = args.bit_order == "msb"
+    stats = {}
+    failures = 0
+    for frame in frames:
+        got = decode_nec(frame.timings, msb)
+        ok = got == frame.expect
+        total, good = stats.get(frame.kind, (0, 0))
+        stats[frame.kind] = (total + 1, good + (1 if ok else 0))
+        if not ok:
+            failures += 1
+            if args.verbose:
+                print("  %s: очікувалося %s, декодовано %s" % (
+                    frame.name,
+                    "none" if frame.expect is None else "0x%X" % frame.expect,
+                    "none" if got is None else "0x%X" % got))
+    for kind in KINDS:
+        if kind in stats:
+            total, good = stats[kind]
+            print("%-10s %3d кадрів, як очікувалося: %3d (%.0f%%)" % (kind, total, good, 100.0 * good / total))
+    return 1 if failures and args.strict else 0
+
+
+# --- заголовок для прошивки --------------------------------------------------
+
+MAX_TICKS = 255     # Тривалість у IrCorpus.h — uint8_t
+MAX_FRAMES = 255    # IR_CORPUS_SIZE та IrCorpusFrame::length — uint8_t
+
+
+def header(args):
+    frames = load(args.corpus)
+    if len(frames) > MAX_FRAMES:
+        sys.exit("У %s %d кадрів, у IrCorpus.h вміщується не більше %d" % (args.corpus, len(frames), MAX_FRAMES))
+    for frame in frames:
+        if len(frame.timings) > MAX_FRAMES:
+            sys.exit("%s: %d тривалостей, не більше %d" % (frame.name, len(frame.timings), MAX_FRAMES))
+        longest = max(frame.timings)
+        if ticks(longest) > MAX_TICKS:
+            sys.exit("%s: тривалість %d мкс довша за %d мкс (%d тиків по %d мкс)"
+                     % (frame.name, longest, MAX_TICKS * MICROS_PER_TICK, MAX_TICKS, MICROS_PER_TICK))
+    kind_names = {k: "IR_KIND_" + k.upper() for k in KINDS}
+    out = []
+    out.append("/**")
+    out.append(" * @file IrCorpus.h")
+    out.append(" * @brief Корпус ІЧ-кадрів для середовища uno_irbench (тики по %d мкс)." % MICROS_PER_TICK)
+    out.append(" *")
+    out.append(" * Згенеровано tools/ir_corpus.py з %s — не редагуйте вручну." % args.corpus.replace("\\", "/"))
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef IRCORPUS_H")
+    out.append("#define IRCORPUS_H")
+    out.append("")
+    out.append('#include "IrBench.h"')
+    out.append("")
+    for n, frame in enumerate(frames):
+        values = [ticks(us) for us in frame.timings]
+        rows = [", ".join(str(v) for v in values[i:i + 16]) for i in range(0, len(values), 16)]
+        out.append("static const uint8_t IR_FRAME_%d[] PROGMEM = {  // %s" % (n, frame.name))
+        out.append("  " + ",\n  ".join(rows))
+        out.append("};")
+    out.append("")
+    out.append("static const IrCorpusFrame IR_CORPUS[] PROGMEM = {")
+    for n, frame in enumerate(frames):
+        expect = "IR_EXPECT_NONE" if frame.expect is None else "0x%XUL" % frame.expect
+        out.append("  { %s, %d, %s, IR_FRAME_%d }," % (kind_names[frame.kind], len(frame.timings), expect, n))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t IR_CORPUS_SIZE = sizeof(IR_CORPUS) / sizeof(IR_CORPUS[0]);")
+    out.append("")
+    out.append("#endif  // IRCORPUS_H")
+    with open(args.out, "w", encoding="utf-8") as f:
+        f.write("\n".join(out) + "\n")
+    print("Записано %d кадрів у %s" % (len(frames), args.out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    p = sub.add_parser("generate", help="синтетичні кадри NEC")
+    p.add_argument("--out", default="corpus/remote.ircorpus")
+    p.add_argument("--seed", type=int, default=2026)
+    p.add_argument("--noisy", type=int, default=8, help="кадрів з тремтінням на кнопку")
+    p.add_argument("--truncated", type=int, default=3, help="обірваних кадрів на кнопку")
+    p.add_argument("--jitter", type=float, default=30, help="СКВ тремтіння фронтів, мкс")
+    p.add_argument("--drift", type=float, default=0.05, help="найбільший розкид частоти пульта, частка")
+    p.add_argument("--excess", type=int, default=80, help="найбільше подовження імпульсу приймачем, мкс")
+    p.add_argument("--bit-order", choices=("msb", "lsb"), default="msb",
+                   help="порядок бітів коду в results.value (IRremote 2.x — msb)")
+    p.set_defaults(func=generate)
+
+    p = sub.add_parser("import", help="кадри з дампу IRremote rawData[]")
+    p.add_argument("dump")
+    p.add_argument("--out", default="corpus/remote.ircorpus")
+    p.add_argument("--name", default="capture-")
+    p.add_argument("--kind", choices=KINDS, default="clean")
+    p.add_argument("--expect", required=True, help="очікуваний код (hex) або none")
+    p.set_defaults(func=import_dump)
+
+    p = sub.add_parser("check", help="перевірка міток еталонним декодером NEC")
+    p.add_argument("corpus")
+    p.add_argument("--bit-order", choices=("msb", "lsb"), default="msb")
+    p.add_argument("--strict", action="store_true", help="код виходу 1, якщо є розбіжності")
+    p.add_argument("--verbose", action="store_true")
+    p.set_defaults(func=check)
+
+    p = sub.add_parser("header", help="include/IrCorpus.h для uno_irbench")
+    p.add_argument("corpus")
+    p.add_argument("--out", default="include/IrCorpus.h")
+    p.set_defaults(func=header)
+
+    args = parser.parse_args()
+    return args.func(args) or 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
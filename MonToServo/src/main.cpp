@@ -12,6 +12,16 @@
  * - PrintAngleFeedback() — виводить результат виконаної дії;
  * - PrintErrorMessage() — повідомляє про помилку введення.
  *
+ * Останній кут зберігається в EEPROM (StateJournal) і відновлюється при
+ * вмиканні ще до attach(), тож після збою живлення серво не «смикається»
+ * до 90°, а продовжує з того самого положення.
+ *
+ * Команда m замість кута виводить звіт про використання SRAM (MemDiag),
+ * команда t — час і лічильники етапів конвеєра.
+ *
+ * Обробка кута — конвеєр lib/Pipeline: порт → перевірка меж → сервопривід
+ * → підтвердження у порт.
+ *
  * Підключення сервоприводу:
  * - Сигнальний провід → D5
  * - Живлення (червоний) → 5V
@@ -25,6 +35,9 @@
 
 #include <Arduino.h>
 #include <Servo.h>
+#include <StateJournal.h>
+#include <MemDiag.h>
+#include <Pipeline.h>
 
 // === Константи ===
 /**
@@ -42,6 +55,11 @@ const int MAX_ANGLE = 180;
 Servo myServo;          ///< Об’єкт для керування сервоприводом
 int currentAngle = 90;  ///< Поточний кут повороту сервоприводу
 
+/**
+ * @brief Журнал останнього кута в EEPROM (1 байт стану, 3 байти на запис).
+ */
+StateJournal journal(0, 384, sizeof(uint8_t));
+
 // === Прототипи функцій ===
 void ShowInstructions();                          // Виводить інструкції у Serial Monitor
 int ReadAngleFromSerial();                        // Зчитує кут, введений користувачем
@@ -50,6 +68,89 @@ void PrintErrorMessage(int angle);                // Повідомляє про
 void ClearSerialBuffer();                         // Очищає буфер Serial
 void MoveServoToAngle(int angle);                 // Повертає серво на вказаний кут
 
+// === Етапи конвеєра ===
+/**
+ * @brief Джерело: кут, введений у Serial Monitor.
+ */
+struct SerialAngleSource
+{
+  typedef int Output;
+
+  bool Poll(int &out)
+  {
+    out = ReadAngleFromSerial();
+    return out >= 0;
+  }
+
+  const __FlashStringHelper *Name() const { return F("serial"); }
+};
+
+/**
+ * @brief Фільтр: пропускає лише кути MIN_ANGLE–MAX_ANGLE, про решту повідомляє.
+ */
+struct AngleValidator
+{
+  typedef int Output;
+
+  bool Process(const int &in, int &out)
+  {
+    if (in < MIN_ANGLE || in > MAX_ANGLE)
+    {
+      PrintErrorMessage(in);
+      return false;
+    }
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("validate"); }
+};
+
+/**
+ * @brief Виконавчий пристрій: сервопривід із збереженням кута в журналі.
+ */
+struct ServoActuator
+{
+  typedef int Output;
+
+  bool Process(const int &in, int &out)
+  {
+    MoveServoToAngle(in);
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("servo"); }
+};
+
+/**
+ * @brief Підтвердження виконаної команди у порт.
+ */
+struct FeedbackStage
+{
+  typedef int Output;
+
+  bool Process(const int &in, int &out)
+  {
+    PrintAngleFeedback(in);
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("feedback"); }
+};
+
+SerialAngleSource serialSource;
+AngleValidator validator;
+ServoActuator servoActuator;
+FeedbackStage feedback;
+
+/**
+ * @brief Конвеєр: порт → перевірка → сервопривід → підтвердження.
+ */
+Pipeline<SerialAngleSource, AngleValidator, ServoActuator, FeedbackStage>
+  pipeline(serialSource, validator, servoActuator, feedback);
+
 
 // === Функція setup() ===
 /**
@@ -57,10 +158,19 @@ void MoveServoToAngle(int angle);                 // Повертає серво
  */
 void setup()
 {
-  Serial.begin(9600);       // Запуск серійного з’єднання
+  uint8_t savedAngle;
+  if (journal.Begin(&savedAngle) && savedAngle <= MAX_ANGLE)
+  {
+    currentAngle = savedAngle; // Кут з EEPROM замість 90°
+  }
+
+  // write() до attach() лише запам’ятовує кут — перший же імпульс буде потрібної ширини
+  myServo.write(currentAngle);
   myServo.attach(SERVO_PIN); // Прив’язка серво до піна
-  myServo.write(currentAngle); // Початковий кут (90°)
+
+  Serial.begin(9600);       // Запуск серійного з’єднання
   ShowInstructions();        // Виведення інструкцій
+  MemDiagReport(Serial, F("після setup()"));
 }
 
 // === Функція loop() ===
@@ -69,20 +179,8 @@ void setup()
  */
 void loop()
 {
-  int angle = ReadAngleFromSerial(); // Зчитування кута з монітора
-
-  if (angle >= 0) // Якщо користувач ввів дані
-  {
-    if (angle >= MIN_ANGLE && angle <= MAX_ANGLE)
-    {
-      MoveServoToAngle(angle);
-      PrintAngleFeedback(angle);
-    }
-    else
-    {
-      PrintErrorMessage(angle);
-    }
-  }
+  journal.Service();                 // Відкладений запис кута в EEPROM
+  pipeline.Run();                    // Кут з монітора → перевірка → серво → відповідь
 }
 
 /**
@@ -93,6 +191,7 @@ void ShowInstructions()
   Serial.println("=== Керування сервоприводом через Serial Monitor ===");
   Serial.println("Введіть кут у межах від 0 до 180 градусів і натисніть Enter.");
   Serial.println("Приклад: 45");
+  Serial.println("m — звіт про використання пам'яті, t — час етапів обробки.");
   Serial.println("-------------------------------------------\n");
 }
 
@@ -102,12 +201,24 @@ void ShowInstructions()
  * Функція чекає, поки у буфері Serial з’являться дані,
  * потім зчитує ціле число (int) і очищає буфер.
  *
- * @return Введений користувачем кут (0–180), або -1, якщо даних немає.
+ * @return Введений користувачем кут (0–180), або -1, якщо даних немає чи введено команду m/t.
  */
 int ReadAngleFromSerial()
 {
   if (Serial.available() > 0)
   {
+    if (Serial.peek() == 'm')      // Команда звіту про пам’ять замість кута
+    {
+      ClearSerialBuffer();
+      MemDiagReport(Serial, F("за запитом"));
+      return -1;
+    }
+    if (Serial.peek() == 't')      // Команда звіту про етапи конвеєра
+    {
+      ClearSerialBuffer();
+      pipeline.Report(Serial);
+      return -1;
+    }
     int value = Serial.parseInt(); // Зчитування числа
     ClearSerialBuffer();           // Очищення буфера після читання
     return value;
@@ -163,4 +274,7 @@ void MoveServoToAngle(int angle)
 {
   currentAngle = angle; // Збереження нового кута
   myServo.write(currentAngle);
+
+  uint8_t saved = currentAngle;
+  journal.Save(&saved);  // В EEPROM потрапить з loop(), коли кут перестане змінюватися
 }
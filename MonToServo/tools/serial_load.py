@@ -0,0 +1,465 @@
+#!/usr/bin/env python3
+"""
+Навантажувальний тест розбору команд MonToServo через серійний порт.
+
+Скрипт надсилає кути із заданою частотою та шаблоном і за відповідями
+плати ("Серво повернуто на кут: N") рахує, скільки команд виконано, скільки
+загублено, скільки спотворено, і затримку від відправлення команди до
+відповіді. Відповідь друкується одразу після myServo.write(), тож затримка
+до write() оцінюється як затримка відповіді мінус час передавання команди
+і самої відповіді на заданій швидкості порту.
+
+Кожна коректна команда — кут 1–180, відмінний від кутів інших команд,
+що ще чекають відповіді, тож відповідь однозначно знаходить свою команду.
+Прошивка обробляє команди по черзі: якщо прийшла відповідь на пізнішу,
+усі раніші без відповіді вважаються загубленими (їх стер ClearSerialBuffer
+або вони не вмістилися в 64-байтовий буфер прийому).
+
+Шаблони (--pattern):
+    steady    — рівномірно, --rate команд за секунду;
+    burst     — пачки по --burst команд підряд, --rate пачок за секунду
+                усередині кроку;
+    pipeline  — --burst рядків одним записом у порт (як вставка з буфера).
+
+--malformed частка команд замінюється некоректним введенням (текст,
+порожній рядок, кут поза межами). Правильна реакція — повідомлення про
+помилку або ігнорування; рух сервоприводу на кут, якого не надсилали
+(наприклад, 0 після тайм-ауту parseInt), рахується як «зайвий рух».
+
+--rate приймає кілька значень через кому — кожне стає окремим кроком,
+що показує, з якої частоти прошивка перестає встигати.
+
+Замість плати можна використати будь-який псевдотермінал (--port /dev/pts/N,
+наприклад від симулятора) або вбудовану модель поточної прошивки (--emulate):
+Stream::parseInt() з тайм-аутом 1 с, ClearSerialBuffer(), 64-байтові буфери
+UART і передавання на --baud. Модель корисна, щоб порівняти зміну розбору
+з поточною поведінкою ще до прошивання.
+
+Приклади:
+    python serial_load.py --port /dev/ttyACM0 --rate 1,2,5,10 --seconds 10
+    python serial_load.py --port /dev/ttyACM0 --pattern pipeline --burst 8
+    python serial_load.py --emulate --rate 2,5 --malformed 0.2
+"""
+
+import argparse
+import collections
+import os
+import random
+import re
+import sys
+import threading
+import time
+
+DEFAULT_BAUD = 9600
+BOOT_SECONDS = 2.5          # Uno перезавантажується при відкритті порту
+DRAIN_SECONDS = 2.0         # Очікування останніх відповідей після кроку
+PARSE_TIMEOUT = 1.0         # Stream::setTimeout() за замовчуванням
+UART_BUFFER = 64            # SERIAL_RX_BUFFER_SIZE / SERIAL_TX_BUFFER_SIZE
+
+ACK_RE = re.compile(r"Серво повернуто на кут:\s*(-?\d+)")
+ERROR_RE = re.compile(r"Помилка: значення\s*(-?\d+)")
+# Рядки, які прошивка друкує сама по собі (інструкція, звіт MemDiag)
+KNOWN_RE = re.compile(r"^(===|Введіть|Приклад|m —|-{5,}|\[MEM\]|(статичні|стек):)")
+
+# Некоректне введення, що не може дати кут 1–180
+MALFORMED = ["abc", "", "x0", "-5", "999", "4000000", "+", "кут"]
+
+
+class Command:
+    __slots__ = ("angle", "text", "sent")
+
+    def __init__(self, angle, text, sent):
+        self.angle = angle      # Очікуваний кут або None для некоректного введення
+        self.text = text
+        self.sent = sent
+
+
+class Step:
+    """Статистика одного кроку частоти."""
+
+    def __init__(self, rate):
+        self.rate = rate
+        self.sent = 0
+        self.malformed = 0
+        self.acked = 0
+        self.dropped = 0
+        self.rejected = 0
+        self.unexpected = 0
+        self.garbled = 0
+        self.latencies = []
+        self.write_latencies = []
+        self.first_ack = None
+        self.last_ack = None
+
+
+def percentile(values, p):
+    if not values:
+        return float("nan")
+    ordered = sorted(values)
+    k = min(len(ordered) - 1, max(0, int(round(p / 100.0 * (len(ordered) - 1)))))
+    return ordered[k]
+
+
+class LineReader(threading.Thread):
+    """Читає відповіді плати у фоні й ставить на кожен рядок мітку часу."""
+
+    def __init__(self, stream):
+        super().__init__(daemon=True)
+        self.stream = stream
+        self.lines = collections.deque()
+        self.raw = bytearray()
+        self.running = True
+
+    def run(self):
+        while self.running:
+            chunk = self.stream.read(256)
+            if not chunk:
+                continue
+            now = time.monotonic()
+            self.raw.extend(chunk)
+            while b"\n" in self.raw:
+                line, _, rest = self.raw.partition(b"\n")
+                self.raw = bytearray(rest)
+                self.lines.append((now, line))
+
+    def take(self):
+        while self.lines:
+            yield self.lines.popleft()
+
+
+class AngleSource:
+    """Видає кути 1–180 так, щоб вони не повторювалися серед тих, що чекають відповіді."""
+
+    def __init__(self, rng):
+        self.rng = rng
+        self.next = rng.randint(1, 180)
+
+    def take(self, busy):
+        for _ in range(180):
+            angle = self.next
+            self.next = self.next % 180 + 1
+            if angle not in busy:
+                return angle
+        return None
+
+
+class LoadRunner:
+    def __init__(self, stream, reader, args):
+        self.stream = stream
+        self.reader = reader
+        self.args = args
+        self.rng = random.Random(args.seed)
+        self.angles = AngleSource(self.rng)
+        self.outstanding = collections.OrderedDict()   # кут → Command
+        self.verbose = args.verbose
+
+    # --- відправлення -------------------------------------------------
+
+    def _make(self, step, now):
+        if self.rng.random() < self.args.malformed:
+            step.malformed += 1
+            return Command(None, self.rng.choice(MALFORMED), now)
+        angle = self.angles.take(self.outstanding)
+        if angle is None:
+            return None
+        return Command(angle, str(angle), now)
+
+    def _send(self, step, commands):
+        data = b"".join((c.text + self.args.eol).encode("utf-8") for c in commands)
+        self.stream.write(data)
+        self.stream.flush()
+        sent = time.monotonic()
+        for c in commands:
+            c.sent = sent
+            step.sent += 1
+            if c.angle is not None:
+                self.outstanding[c.angle] = c
+            if self.verbose:
+                print("  >> %r" % c.text)
+
+    # --- прийом -------------------------------------------------------
+
+    def _reply_bytes(self, line, command):
+        return len(line) + 1 + len((command.text + self.args.eol).encode("utf-8"))
+
+    def _handle(self, step, stamp, raw):
+        try:
+            line = raw.decode("utf-8").strip()
+        except UnicodeDecodeError:
+            step.garbled += 1
+            if self.verbose:
+                print("  << (пошкоджено) %r" % raw)
+            return
+        if self.verbose and line:
+            print("  << " + line)
+        if not line:
+            return
+
+        match = ACK_RE.search(line)
+        if match:
+            angle = int(match.group(1))
+            command = self.outstanding.get(angle)
+            if command is None:
+                step.unexpected += 1
+                return
+            # Усе, що надіслано раніше і досі без відповіді, прошивка пропустила
+            for older in list(self.outstanding):
+                if older == angle:
+                    break
+                del self.outstanding[older]
+                step.dropped += 1
+            del self.outstanding[angle]
+            latency = stamp - command.sent
+            wire = self._reply_bytes(raw, command) * 10.0 / self.args.baud
+            step.acked += 1
+            step.latencies.append(latency)
+            step.write_latencies.append(max(0.0, latency - wire))
+            if step.first_ack is None:
+                step.first_ack = stamp
+            step.last_ack = stamp
+            return
+
+        if ERROR_RE.search(line):
+            step.rejected += 1
+            return
+        if not KNOWN_RE.search(line):
+            step.garbled += 1
+
+    def _poll(self, step):
+        for stamp, raw in self.reader.take():
+            self._handle(step, stamp, raw)
+
+    # --- крок навантаження --------------------------------------------
+
+    def run_step(self, rate):
+        step = Step(rate)
+        pattern = self.args.pattern
+        group = 1 if pattern == "steady" else self.args.burst
+        period = 1.0 / rate
+        start = time.monotonic()
+        deadline = start + self.args.seconds
+        due = start
+
+        while True:
+            now = time.monotonic()
+            if now >= deadline:
+                break
+            if now >= due:
+                batch = [c for c in (self._make(step, now) for _ in range(group)) if c is not None]
+                if pattern == "burst":
+                    for c in batch:
+                        self._send(step, [c])
+                elif batch:
+                    self._send(step, batch)
+                due += period
+            self._poll(step)
+            time.sleep(min(0.002, max(0.0, due - time.monotonic())))
+
+        # Даємо прошивці доробити чергу, решту вважаємо загубленою
+        drain_end = time.monotonic() + self.args.drain
+        while time.monotonic() < drain_end and self.outstanding:
+            self._poll(step)
+            time.sleep(0.01)
+        self._poll(step)
+        step.dropped += len(self.outstanding)
+        self.outstanding.clear()
+        step.duration = time.monotonic() - start
+        return step
+
+
+def print_step(step, pattern, burst):
+    valid = step.sent - step.malformed
+    span = (step.last_ack - step.first_ack) if step.acked > 1 else 0.0
+    throughput = (step.acked - 1) / span if span > 0 else float("nan")
+    unit = "команд/с" if pattern == "steady" else "пачок/с по %d" % burst
+    print("\nЧастота: %g %s" % (step.rate, unit))
+    print("  надіслано: %d (коректних %d, некоректних %d)" % (step.sent, valid, step.malformed))
+    print("  виконано: %d (%.1f%%), загублено: %d, відхилено з помилкою: %d"
+          % (step.acked, 100.0 * step.acked / valid if valid else 0.0, step.dropped, step.rejected))
+    print("  зайвих рухів: %d, пошкоджених рядків: %d" % (step.unexpected, step.garbled))
+    print("  пропускна здатність: %.2f команд/с" % throughput)
+    if step.latencies:
+        ms = lambda v: v * 1000.0
+        print("  затримка відповіді, мс: p50 %.1f  p90 %.1f  p99 %.1f  макс %.1f"
+              % tuple(ms(percentile(step.latencies, p)) for p in (50, 90, 99, 100)))
+        print("  оцінка до write(), мс:   p50 %.1f  p90 %.1f  p99 %.1f  макс %.1f"
+              % tuple(ms(percentile(step.write_latencies, p)) for p in (50, 90, 99, 100)))
+
+
+class FirmwareModel(threading.Thread):
+    """
+    Модель поточного циклу MonToServo на псевдотерміналі.
+
+    Відтворює те, що визначає пропускну здатність: байти надходять не
+    швидше за baud, зайве понад 64 байти в буфері прийому губиться,
+    parseInt() пропускає нецифрові символи й чекає до PARSE_TIMEOUT,
+    ClearSerialBuffer() стирає все, що встигло прийти, а відповідь
+    передається на baud з 64-байтовим буфером передавання.
+    """
+
+    def __init__(self, fd, baud):
+        super().__init__(daemon=True)
+        self.fd = fd
+        self.byte_time = 10.0 / baud
+        self.arrivals = collections.deque()   # (момент надходження, байт)
+        self.last_arrival = 0.0
+        self.rx = collections.deque()
+        self.tx_done = 0.0
+        self.overruns = 0
+        self.writes = 0
+
+    def _advance(self):
+        now = time.monotonic()
+        try:
+            data = os.read(self.fd, 1024)
+        except (BlockingIOError, OSError):
+            data = b""
+        for b in data:
+            self.last_arrival = max(self.last_arrival, now) + self.byte_time
+            self.arrivals.append((self.last_arrival, b))
+        while self.arrivals and self.arrivals[0][0] <= now:
+            _, b = self.arrivals.popleft()
+            if len(self.rx) < UART_BUFFER - 1:
+                self.rx.append(b)
+            else:
+                self.overruns += 1
+
+    def _timed_peek(self):
+        end = time.monotonic() + PARSE_TIMEOUT
+        while True:
+            self._advance()
+            if self.rx:
+                return self.rx[0]
+            if time.monotonic() >= end:
+                return None
+            time.sleep(0.0005)
+
+    def _parse_int(self):
+        # Stream::peekNextDigit(): пропускає все, крім цифр і '-'
+        while True:
+            c = self._timed_peek()
+            if c is None:
+                return 0
+            if c == ord("-") or ord("0") <= c <= ord("9"):
+                break
+            self.rx.popleft()
+        negative = False
+        value = 0
+        while True:
+            c = self._timed_peek()
+            if c == ord("-"):
+                negative = True
+            elif c is not None and ord("0") <= c <= ord("9"):
+                value = value * 10 + c - ord("0")
+            else:
+                break
+            self.rx.popleft()
+        value = -value if negative else value
+        return ((value + 0x8000) & 0xFFFF) - 0x8000   # int на AVR — 16 біт
+
+    def _print(self, text):
+        data = text.encode("utf-8")
+        for b in data:
+            # Чекаємо місця в буфері передавання, прийом тим часом триває
+            while self.tx_done - time.monotonic() > UART_BUFFER * self.byte_time:
+                self._advance()
+                time.sleep(0.0005)
+            self.tx_done = max(self.tx_done, time.monotonic()) + self.byte_time
+            delay = self.tx_done - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            os.write(self.fd, bytes([b]))
+
+    def run(self):
+        self._print("=== Модель MonToServo ===\n")
+        while True:
+            self._advance()
+            if not self.rx:
+                time.sleep(0.0005)
+                continue
+            angle = self._parse_int()
+            self._advance()
+            self.rx.clear()                       # ClearSerialBuffer()
+            if angle < 0:
+                continue                          # loop() ігнорує від'ємні значення
+            if angle <= 180:
+                self.writes += 1                  # myServo.write(angle)
+                self._print("✅ Серво повернуто на кут: %d°\n\n" % angle)
+            else:
+                self._print("⚠️  Помилка: значення %d виходить за межі 0–180°.\n\n" % angle)
+
+
+def open_emulator(baud):
+    import pty
+    import serial  # pyserial
+    master, slave = pty.openpty()
+    os.set_blocking(master, False)
+    import tty
+    tty.setraw(slave)
+    model = FirmwareModel(master, baud)
+    model.start()
+    stream = serial.Serial(os.ttyname(slave), baud, timeout=0.05)
+    return stream, model
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("--port", help="серійний порт плати або псевдотермінал")
+    group.add_argument("--emulate", action="store_true", help="модель поточної прошивки на псевдотерміналі")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD)
+    parser.add_argument("--rate", default="1,2,5", help="частоти кроків через кому")
+    parser.add_argument("--seconds", type=float, default=10.0, help="тривалість кожного кроку")
+    parser.add_argument("--pattern", choices=("steady", "burst", "pipeline"), default="steady")
+    parser.add_argument("--burst", type=int, default=4, help="команд у пачці (burst, pipeline)")
+    parser.add_argument("--malformed", type=float, default=0.0, help="частка некоректних команд, 0–1")
+    parser.add_argument("--eol", default="\n", help="кінець рядка (як у Serial Monitor)")
+    parser.add_argument("--boot", type=float, default=BOOT_SECONDS, help="очікування запуску плати, с")
+    parser.add_argument("--drain", type=float, default=DRAIN_SECONDS, help="очікування відповідей після кроку, с")
+    parser.add_argument("--seed", type=int, default=1, help="зерно вибору кутів і некоректних команд")
+    parser.add_argument("--verbose", action="store_true", help="друкувати обмін з платою")
+    args = parser.parse_args()
+    args.eol = args.eol.encode("utf-8").decode("unicode_escape")
+
+    rates = [float(r) for r in args.rate.split(",") if r.strip()]
+    if not rates or min(rates) <= 0:
+        parser.error("--rate: потрібні додатні частоти")
+
+    model = None
+    if args.emulate:
+        stream, model = open_emulator(args.baud)
+        args.boot = min(args.boot, 0.3)
+    else:
+        import serial  # pyserial
+        stream = serial.Serial(args.port, args.baud, timeout=0.05)
+
+    reader = LineReader(stream)
+    reader.start()
+
+    # Інструкцію та звіт про пам’ять після запуску пропускаємо
+    time.sleep(args.boot)
+    list(reader.take())
+
+    runner = LoadRunner(stream, reader, args)
+    total_dropped = total_unexpected = total_garbled = 0
+    try:
+        for rate in rates:
+            step = runner.run_step(rate)
+            print_step(step, args.pattern, args.burst)
+            total_dropped += step.dropped
+            total_unexpected += step.unexpected
+            total_garbled += step.garbled
+    except KeyboardInterrupt:
+        pass
+    finally:
+        reader.running = False
+
+    if model is not None:
+        print("\nМодель: викликів write(): %d, переповнень буфера прийому: %d" % (model.writes, model.overruns))
+
+    # Ненульовий код виходу зручний для перевірки змін розбору в скриптах
+    return 1 if (total_dropped or total_unexpected or total_garbled) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
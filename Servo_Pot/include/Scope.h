@@ -0,0 +1,103 @@
+/**
+ * @file Scope.h
+ * @brief Режим осцилографа: вибірки потенціометра з фіксованою частотою у двійкових кадрах.
+ *
+ * Звичайний режим виводить кут лише при зміні на ANGLE_TOLERANCE, тож
+ * шум, «дрижання» ручки чи просідання живлення під час руху сервоприводу
+ * не видно. Тут Timer2 (режим CTC) з фіксованим періодом забирає готовий
+ * результат АЦП і запускає наступне перетворення. Вибірки збираються у
+ * подвійний буфер: поки один блок заповнюється в перериванні, інший
+ * пакується й відправляється з loop(). Якщо обидва блоки зайняті, новий
+ * блок відкидається, але його номер усе одно витрачається — скрипт
+ * tools/scope.py бачить пропуск у нумерації.
+ *
+ * Формат кадру (усі поля — байти):
+ * - 0xA5 0x5A         — синхронізація;
+ * - seq               — номер блоку (за модулем 256);
+ * - count             — кількість вибірок (кратна 4);
+ * - count/4 груп по 5 байтів: молодші 8 бітів чотирьох вибірок,
+ *   далі байт зі старшими 2 бітами (вибірка k — біти 2k+1..2k);
+ * - sum1 sum2         — контрольна сума Флетчера-16 від seq до кінця даних.
+ *
+ * Займає Timer2 (несумісний з tone() та analogWrite на 3/11) і АЦП.
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef SCOPE_H
+#define SCOPE_H
+
+#include <Arduino.h>
+
+const uint8_t SCOPE_SYNC_1 = 0xA5;      ///< Перший байт синхронізації
+const uint8_t SCOPE_SYNC_2 = 0x5A;      ///< Другий байт синхронізації
+const uint8_t SCOPE_BLOCK = 64;         ///< Вибірок у кадрі (кратне 4)
+const uint16_t SCOPE_MAX_RATE_HZ = 10000; ///< Найвища частота: АЦП (52 мкс) + переривання
+const uint16_t SCOPE_MIN_RATE_HZ = 62;    ///< Найнижча частота Timer2: 16 МГц / 1024 / 256
+
+/**
+ * @brief Розмір кадру у байтах: заголовок, 10-бітні вибірки, контрольна сума.
+ */
+const uint8_t SCOPE_FRAME_BYTES = 4 + SCOPE_BLOCK / 4 * 5 + 2;
+
+/**
+ * @brief Запускає вибірки аналогового входу з частотою rateHz.
+ *
+ * Подільник Timer2 підбирається найменший можливий, тож фактична частота
+ * (ScopeRate()) може трохи відрізнятися від заданої.
+ *
+ * @param pin    Аналоговий вхід (A0–A7).
+ * @param rateHz Частота вибірок, SCOPE_MIN_RATE_HZ–SCOPE_MAX_RATE_HZ Гц
+ *               (значення поза межами, зокрема 0, обмежуються).
+ */
+void ScopeBegin(uint8_t pin, uint16_t rateHz);
+
+/**
+ * @brief Зупиняє таймер вибірок.
+ */
+void ScopeStop();
+
+/**
+ * @brief Фактична частота вибірок, Гц.
+ */
+uint16_t ScopeRate();
+
+/**
+ * @brief Чи є заповнений блок, що очікує відправлення.
+ */
+bool ScopeFrameReady();
+
+/**
+ * @brief Пакує та відправляє заповнений блок, якщо він є.
+ *
+ * Блок звільняється одразу після пакування, ще до відправлення, тож
+ * переривання може заповнювати обидва буфери, поки кадр іде в порт.
+ *
+ * @return true, якщо кадр відправлено.
+ */
+bool ScopeService(Print &out);
+
+/**
+ * @brief Остання вибірка (0–1023).
+ */
+uint16_t ScopeLatest();
+
+/**
+ * @brief Кількість блоків, відкинутих через переповнення.
+ */
+uint16_t ScopeDropped();
+
+/**
+ * @brief Пакує вибірки у кадр описаного формату.
+ *
+ * @param samples Вибірки 0–1023.
+ * @param count   Кількість вибірок (кратна 4, не більше SCOPE_BLOCK).
+ * @param seq     Номер блоку.
+ * @param frame   Буфер щонайменше на SCOPE_FRAME_BYTES байтів.
+ * @return Довжина кадру в байтах.
+ */
+uint8_t ScopePackFrame(const uint16_t samples[], uint8_t count, uint8_t seq, uint8_t frame[]);
+
+#endif  // SCOPE_H
@@ -0,0 +1,131 @@
+/**
+ * @file Trajectory.h
+ * @brief Запис і відтворення траєкторії сервоприводу в EEPROM зі стисненням.
+ *
+ * Кут записується на кожному тіку фіксованого періоду, але зберігаються не самі кути,
+ * а зміни між ними:
+ *
+ * - 0ddddddd — зміна кута на d (7-бітне число зі знаком, −63…+63);
+ * - 01000000 — (d = −64) екранування: наступний байт — абсолютний кут;
+ * - 1nnnnnnn — кут не змінювався ще n + 1 тіків (1…128).
+ *
+ * Нерухомий сервопривід займає 1 байт на 2,5 с (при тіку 20 мс), плавний
+ * рух — 1 байт на тік, тож 1 КБ EEPROM вміщує хвилини типової роботи
+ * замість 20 с «сирих» кутів.
+ *
+ * Розміщення в EEPROM (з адреси base):
+ * - 'T' 'J', тік (мс), перший кут, кількість байтів даних без заголовка (uint16),
+ *   кількість тіків (uint16) — заголовок пишеться лише в End();
+ * - далі дані.
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <Arduino.h>
+
+const uint8_t TRAJECTORY_HEADER_BYTES = 8;   ///< Розмір заголовка
+const uint8_t TRAJECTORY_ESCAPE = 0x40;      ///< Байт екранування абсолютного кута
+const uint8_t TRAJECTORY_RUN = 0x80;         ///< Прапорець серії повторів
+
+/**
+ * @brief Кодувальник траєкторії, що пише в EEPROM.
+ *
+ * @example
+ *  TrajectoryWriter writer(0, 1024);
+ *  writer.Begin(20, angle);
+ *  while (recording) if (!writer.Add(angle)) break;  // EEPROM заповнено
+ *  writer.End();
+ */
+class TrajectoryWriter
+{
+public:
+  /**
+   * @param base Адреса початку області в EEPROM.
+   * @param size Розмір області у байтах (разом із заголовком).
+   */
+  TrajectoryWriter(uint16_t base, uint16_t size);
+
+  /**
+   * @brief Починає новий запис; попередній запис стає недійсним.
+   *
+   * @param tickMs     Період тіку в мілісекундах.
+   * @param firstAngle Кут на першому тіку.
+   */
+  void Begin(uint8_t tickMs, uint8_t firstAngle);
+
+  /**
+   * @brief Додає кут наступного тіку.
+   *
+   * @return false, якщо місця немає (тік не записано, слід викликати End()).
+   */
+  bool Add(uint8_t angle);
+
+  /**
+   * @brief Завершує запис: дописує незакриту серію та заголовок.
+   */
+  void End();
+
+  uint16_t Ticks() const { return _ticks; }                                      ///< Записано тіків
+  uint16_t Bytes() const { return _pos - _base + (_run ? 1 : 0); }               ///< Зайнято байтів (із заголовком)
+  uint16_t Capacity() const { return _end - _base; }                             ///< Розмір області
+
+private:
+  bool Fits(uint8_t bytes) const;
+  void Emit(uint8_t value);
+
+  uint16_t _base;
+  uint16_t _end;
+  uint16_t _pos;      ///< Адреса наступного байта даних
+  uint16_t _ticks;
+  uint8_t _tickMs;
+  uint8_t _first;
+  uint8_t _last;      ///< Кут попереднього тіку
+  uint8_t _run;       ///< Повторів, ще не записаних в EEPROM
+};
+
+/**
+ * @brief Декодувальник траєкторії з EEPROM.
+ */
+class TrajectoryReader
+{
+public:
+  TrajectoryReader(uint16_t base, uint16_t size);
+
+  /**
+   * @brief Перевіряє заголовок і стає на початок запису.
+   *
+   * @return false, якщо в EEPROM немає цілого запису.
+   */
+  bool Begin();
+
+  /**
+   * @brief Повертає кут наступного тіку.
+   *
+   * @return false, якщо запис закінчився.
+   */
+  bool Next(uint8_t &angle);
+
+  uint8_t TickMs() const { return _tickMs; }     ///< Період тіку запису
+  uint16_t Ticks() const { return _ticks; }      ///< Тіків у записі
+  uint16_t Played() const { return _played; }    ///< Уже відтворено тіків
+  uint16_t Bytes() const { return _bytes; }      ///< Байтів у записі (із заголовком)
+
+private:
+  uint16_t _base;
+  uint16_t _end;
+  uint16_t _pos;
+  uint16_t _ticks;
+  uint16_t _played;
+  uint16_t _bytes;
+  uint8_t _tickMs;
+  uint8_t _first;
+  uint8_t _last;
+  uint8_t _run;
+};
+
+#endif  // TRAJECTORY_H
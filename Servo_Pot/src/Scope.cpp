@@ -0,0 +1,173 @@
+/**
+ * @file Scope.cpp
+ * @brief Реалізація режиму осцилографа на Timer2 та АЦП.
+ *
+ * Переривання Timer2 читає результат перетворення, запущеного попереднім
+ * перериванням, і одразу запускає наступне. Отже, момент вибірки задає
+ * таймер (з точністю до затримки входу в переривання), а не loop().
+ */
+
+#include "Scope.h"
+
+#include <avr/interrupt.h>
+
+/**
+ * @brief Подільники Timer2 та відповідні біти CS22:CS20.
+ */
+static const uint16_t PRESCALERS[] = { 1, 8, 32, 64, 128, 256, 1024 };
+
+static uint16_t blocks[2][SCOPE_BLOCK];  ///< Подвійний буфер вибірок
+static uint8_t fillBlock;                ///< Блок, який заповнює переривання
+static uint8_t fillCount;                ///< Вибірок у блоці, що заповнюється
+static uint8_t fillSeq;                  ///< Номер блоку, що заповнюється
+static volatile int8_t readyBlock = -1;  ///< Заповнений блок, що чекає відправлення
+static volatile uint8_t readySeq;        ///< Його номер
+static volatile uint16_t latest;         ///< Остання вибірка
+static volatile uint16_t dropped;        ///< Відкинуті блоки
+static uint16_t rate;                    ///< Фактична частота, Гц
+
+void ScopeBegin(uint8_t pin, uint16_t rateHz)
+{
+  if (rateHz > SCOPE_MAX_RATE_HZ) rateHz = SCOPE_MAX_RATE_HZ;
+  if (rateHz < SCOPE_MIN_RATE_HZ) rateHz = SCOPE_MIN_RATE_HZ;
+  if (pin >= A0) pin -= A0;
+
+  // Найменший подільник, за якого період вміщується у 8-бітний OCR2A
+  uint8_t cs = 0;
+  uint32_t top = 0;
+  while (cs < 7)
+  {
+    top = F_CPU / PRESCALERS[cs] / rateHz;
+    if (top <= 256) break;
+    cs++;
+  }
+  if (top > 256) top = 256;
+  if (top < 2) top = 2;
+  rate = F_CPU / PRESCALERS[cs] / top;
+
+  uint8_t oldSREG = SREG;
+  cli();
+
+  fillBlock = 0;
+  fillCount = 0;
+  fillSeq = 0;
+  readyBlock = -1;
+  dropped = 0;
+
+  // АЦП: опора AVcc, подільник 64 (250 кГц, ~52 мкс на перетворення)
+  ADMUX = _BV(REFS0) | (pin & 0x07);
+  ADCSRA = _BV(ADEN) | _BV(ADPS2) | _BV(ADPS1);
+  ADCSRA |= _BV(ADSC);
+
+  // Timer2: CTC, TOP = OCR2A
+  TCCR2A = _BV(WGM21);
+  TCCR2B = cs + 1;
+  OCR2A = (uint8_t)(top - 1);
+  TCNT2 = 0;
+  TIFR2 = _BV(OCF2A);
+  TIMSK2 = _BV(OCIE2A);
+
+  SREG = oldSREG;
+}
+
+void ScopeStop()
+{
+  TIMSK2 = 0;
+  TCCR2B = 0;
+}
+
+uint16_t ScopeRate()
+{
+  return rate;
+}
+
+bool ScopeFrameReady()
+{
+  return readyBlock >= 0;
+}
+
+uint16_t ScopeLatest()
+{
+  uint8_t oldSREG = SREG;
+  cli();
+  uint16_t value = latest;
+  SREG = oldSREG;
+  return value;
+}
+
+uint16_t ScopeDropped()
+{
+  uint8_t oldSREG = SREG;
+  cli();
+  uint16_t value = dropped;
+  SREG = oldSREG;
+  return value;
+}
+
+uint8_t ScopePackFrame(const uint16_t samples[], uint8_t count, uint8_t seq, uint8_t frame[])
+{
+  uint8_t len = 0;
+  frame[len++] = SCOPE_SYNC_1;
+  frame[len++] = SCOPE_SYNC_2;
+  frame[len++] = seq;
+  frame[len++] = count;
+
+  for (uint8_t i = 0; i < count; i += 4)
+  {
+    uint8_t high = 0;
+    for (uint8_t k = 0; k < 4; k++)
+    {
+      frame[len++] = (uint8_t)samples[i + k];
+      high |= (uint8_t)((samples[i + k] >> 8) & 0x03) << (2 * k);
+    }
+    frame[len++] = high;
+  }
+
+  // Флетчер-16 від seq до кінця даних
+  uint16_t sum1 = 0;
+  uint16_t sum2 = 0;
+  for (uint8_t i = 2; i < len; i++)
+  {
+    sum1 = (sum1 + frame[i]) % 255;
+    sum2 = (sum2 + sum1) % 255;
+  }
+  frame[len++] = (uint8_t)sum1;
+  frame[len++] = (uint8_t)sum2;
+  return len;
+}
+
+bool ScopeService(Print &out)
+{
+  if (readyBlock < 0) return false;
+
+  static uint8_t frame[SCOPE_FRAME_BYTES];
+  uint8_t len = ScopePackFrame(blocks[readyBlock], SCOPE_BLOCK, readySeq, frame);
+  readyBlock = -1;  // Блок вільний — переривання може заповнювати його знову
+
+  out.write(frame, len);
+  return true;
+}
+
+ISR(TIMER2_COMPA_vect)
+{
+  // Результат перетворення, запущеного попереднім перериванням
+  uint16_t value = ADC;
+  ADCSRA |= _BV(ADSC);
+
+  latest = value;
+  blocks[fillBlock][fillCount++] = value;
+  if (fillCount < SCOPE_BLOCK) return;
+
+  fillCount = 0;
+  if (readyBlock < 0)
+  {
+    readyBlock = fillBlock;
+    readySeq = fillSeq;
+    fillBlock ^= 1;
+  }
+  else
+  {
+    dropped++;  // Обидва блоки зайняті — цей блок перезаписується
+  }
+  fillSeq++;
+}
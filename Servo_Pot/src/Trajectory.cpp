@@ -0,0 +1,175 @@
+/**
+ * @file Trajectory.cpp
+ * @brief Реалізація стисненого запису траєкторії в EEPROM.
+ */
+
+#include "Trajectory.h"
+
+#include <EEPROM.h>
+
+static const uint8_t MAGIC_0 = 'T';
+static const uint8_t MAGIC_1 = 'J';
+static const uint8_t RUN_MAX = 128;   ///< Найдовша серія в одному байті
+
+// ----------------------------------------------------------
+//                      Запис
+// ----------------------------------------------------------
+
+TrajectoryWriter::TrajectoryWriter(uint16_t base, uint16_t size)
+  : _base(base), _end(base + size), _pos(base + TRAJECTORY_HEADER_BYTES),
+    _ticks(0), _tickMs(0), _first(0), _last(0), _run(0)
+{
+}
+
+void TrajectoryWriter::Begin(uint8_t tickMs, uint8_t firstAngle)
+{
+  // Старий заголовок затирається одразу: обірваний запис не буде прийнято за цілий
+  EEPROM.update(_base, 0xFF);
+
+  _pos = _base + TRAJECTORY_HEADER_BYTES;
+  _tickMs = tickMs;
+  _first = _last = firstAngle;
+  _run = 0;
+  _ticks = 1;
+}
+
+bool TrajectoryWriter::Fits(uint8_t bytes) const
+{
+  // Один байт завжди лишається на закриття незавершеної серії
+  return _pos + bytes + 1 <= _end;
+}
+
+void TrajectoryWriter::Emit(uint8_t value)
+{
+  EEPROM.update(_pos++, value);   // update() не витрачає ресурс на однакові байти
+}
+
+bool TrajectoryWriter::Add(uint8_t angle)
+{
+  if (_ticks == 0xFFFF) return false;
+
+  if (angle == _last)
+  {
+    if (_run + 1 == RUN_MAX)
+    {
+      if (!Fits(1)) return false;
+      Emit(TRAJECTORY_RUN | (RUN_MAX - 1));
+      _run = 0;
+    }
+    else
+    {
+      _run++;
+    }
+    _ticks++;
+    return true;
+  }
+
+  int delta = (int)angle - _last;
+  bool small = (delta >= -63 && delta <= 63);
+  if (!Fits((_run ? 1 : 0) + (small ? 1 : 2))) return false;
+
+  if (_run)
+  {
+    Emit(TRAJECTORY_RUN | (_run - 1));
+    _run = 0;
+  }
+
+  if (small)
+  {
+    Emit((uint8_t)delta & 0x7F);
+  }
+  else
+  {
+    Emit(TRAJECTORY_ESCAPE);
+    Emit(angle);
+  }
+
+  _last = angle;
+  _ticks++;
+  return true;
+}
+
+void TrajectoryWriter::End()
+{
+  if (_run)
+  {
+    Emit(TRAJECTORY_RUN | (_run - 1));
+    _run = 0;
+  }
+
+  uint16_t bytes = _pos - _base - TRAJECTORY_HEADER_BYTES;
+
+  // Сигнатура пишеться останньою — запис стає дійсним лише цілим
+  EEPROM.update(_base + 2, _tickMs);
+  EEPROM.update(_base + 3, _first);
+  EEPROM.update(_base + 4, bytes & 0xFF);
+  EEPROM.update(_base + 5, bytes >> 8);
+  EEPROM.update(_base + 6, _ticks & 0xFF);
+  EEPROM.update(_base + 7, _ticks >> 8);
+  EEPROM.update(_base + 1, MAGIC_1);
+  EEPROM.update(_base, MAGIC_0);
+}
+
+// ----------------------------------------------------------
+//                    Відтворення
+// ----------------------------------------------------------
+
+TrajectoryReader::TrajectoryReader(uint16_t base, uint16_t size)
+  : _base(base), _end(base + size), _pos(base + TRAJECTORY_HEADER_BYTES),
+    _ticks(0), _played(0), _bytes(0), _tickMs(0), _first(0), _last(0), _run(0)
+{
+}
+
+bool TrajectoryReader::Begin()
+{
+  _played = 0;
+  _run = 0;
+  _pos = _base + TRAJECTORY_HEADER_BYTES;
+
+  if (EEPROM.read(_base) != MAGIC_0 || EEPROM.read(_base + 1) != MAGIC_1) return false;
+
+  _tickMs = EEPROM.read(_base + 2);
+  _first = EEPROM.read(_base + 3);
+  uint16_t data = EEPROM.read(_base + 4) | (EEPROM.read(_base + 5) << 8);
+  _ticks = EEPROM.read(_base + 6) | (EEPROM.read(_base + 7) << 8);
+  _bytes = TRAJECTORY_HEADER_BYTES + data;
+
+  return _tickMs != 0 && _ticks != 0 && _base + _bytes <= _end;
+}
+
+bool TrajectoryReader::Next(uint8_t &angle)
+{
+  if (_played >= _ticks) return false;
+
+  if (_played == 0)
+  {
+    _last = _first;
+  }
+  else if (_run > 0)
+  {
+    _run--;
+  }
+  else
+  {
+    if (_pos >= _base + _bytes) return false;   // Пошкоджений запис
+    uint8_t b = EEPROM.read(_pos++);
+
+    if (b & TRAJECTORY_RUN)
+    {
+      _run = b & 0x7F;            // Цей тік і ще _run тіків — той самий кут
+    }
+    else if (b == TRAJECTORY_ESCAPE)
+    {
+      _last = EEPROM.read(_pos++);
+    }
+    else
+    {
+      int delta = (b & 0x40) ? (int)b - 128 : b;
+      _last += delta;
+    }
+  }
+
+  angle = _last;
+  _played++;
+  return true;
+}
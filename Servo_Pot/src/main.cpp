@@ -10,6 +10,21 @@
  * Для користувача виводиться "графічний" індикатор поточного кута у вигляді шкали,
  * що дозволяє візуально оцінити положення сервоприводу.
  *
+ * Середовище uno_scope (SCOPE_MODE) замість тексту передає сирі вибірки A0
+ * з частотою SCOPE_RATE_HZ двійковими кадрами (див. include/Scope.h);
+ * сигнал відновлює скрипт tools/scope.py.
+ *
+ * Рух можна записати в EEPROM і відтворити без комп’ютера (див. include/Trajectory.h):
+ *   r — почати запис, s — зупинити запис/відтворення,
+ *   p — відтворити один раз, l — відтворювати по колу,
+ *   кнопка на D2 — запустити/зупинити відтворення.
+ * Команда m виводить звіт про використання SRAM (див. lib/MemDiag),
+ * команда t — час і лічильники етапів конвеєра.
+ *
+ * Потік даних — конвеєр lib/Pipeline: потенціометр → кут → запис
+ * траєкторії → сервопривід → фільтр змін → шкала у порту. Відтворений
+ * кут подається одразу в етап запису, минаючи потенціометр.
+ *
  * --- Підключення ---
  *  Потенціометр:
  *    - Лівий контакт  → GND
@@ -21,8 +36,14 @@
  *    - Червоний (живлення) → 5V
  *    - Коричневий (земля) → GND
  *
+ *  Кнопка відтворення: D2 → GND (внутрішня підтяжка)
+ *
  * --- Необхідні бібліотеки ---
  *  - Servo.h  (входить до стандартної бібліотеки Arduino IDE)
+ *  - Idle.h   (сон між вимірюваннями, спільна бібліотека з lib/)
+ *  - Gauge.h  (рядок зі шкалою кута, спільна бібліотека з lib/)
+ *  - MemDiag.h (звіт про SRAM, спільна бібліотека з lib/)
+ *  - Pipeline.h (конвеєр етапів, спільна бібліотека з lib/)
  *
  * --- Автор ---
  *  @author  Дмитро Агеєв
@@ -32,6 +53,17 @@
 
 #include <Arduino.h>  // Основна бібліотека Arduino
 #include <Servo.h>    // Клас для роботи з сервоприводами
+#include <Idle.h>     // Сон між вимірюваннями та вимірювання АЦП у сні
+#include <Gauge.h>    // Рядок зі шкалою одним записом у порт
+#include <MemDiag.h>  // Звіт про використання SRAM
+#include <Pipeline.h>       // Конвеєр етапів зі статичним викликом
+#include <PipelineStages.h> // Типові етапи: map, зона нечутливості, фільтр змін
+
+#include "Trajectory.h"  // Запис і відтворення траєкторії в EEPROM
+
+#ifdef SCOPE_MODE
+#include "Scope.h"    // Режим осцилографа: двійкові кадри вибірок
+#endif
 
 // ----------------------------------------------------------
 //               Глобальні константи та змінні
@@ -59,12 +91,63 @@ const int MAX_ANGLE = 180;
 const int ANGLE_TOLERANCE = 5;
 
 /**
- * @brief Мінімальна зміна кута, за якої оновлюється вивід у монітор.
+ * @brief Кількість поділок шкали (одна поділка — ANGLE_TOLERANCE градусів).
  */
 const int MAX_SEGMENT = (MAX_ANGLE - MIN_ANGLE) / ANGLE_TOLERANCE;
 
+/**
+ * @brief Оформлення рядка з кутом у Serial Monitor.
+ */
+const GaugeStyle ANGLE_GAUGE = { "Кут: ", "° \t", MAX_SEGMENT, '#', '-', false };
+
+/**
+ * @brief Пін кнопки відтворення (замикає на GND).
+ */
+const int BUTTON_PIN = 2;
+
+/**
+ * @brief Період вимірювань потенціометра (мс) — один кадр сервоприводу,
+ *        він же тік запису траєкторії.
+ */
+const unsigned long SAMPLE_PERIOD_MS = 20;
+
+/**
+ * @brief Зміни кута не більше за цю величину не записуються (шум потенціометра).
+ */
+const int RECORD_DEADBAND = 1;
+
+/**
+ * @brief Режим роботи: живе керування, запис або відтворення траєкторії.
+ */
+enum Mode { MODE_LIVE, MODE_RECORD, MODE_REPLAY };
+
 Servo myServo;        ///< Об’єкт сервоприводу
-int lastAngle = -1;   ///< Збережений попередній кут для перевірки змін
+unsigned long nextSampleMs = 0; ///< Момент наступного вимірювання
+
+TrajectoryWriter recorder(0, E2END + 1);  ///< Запис траєкторії (уся EEPROM)
+TrajectoryReader player(0, E2END + 1);    ///< Відтворення траєкторії
+Mode mode = MODE_LIVE;                    ///< Поточний режим
+bool replayLoop = false;                  ///< Відтворювати по колу
+int servoAngle = 90;                      ///< Кут, виставлений на останньому тіку
+Deadband recordDeadband(RECORD_DEADBAND); ///< Зона нечутливості запису
+unsigned long replayTicks = 0;            ///< Відтворено тіків (з урахуванням повторів по колу)
+unsigned long replayFirstMs = 0;          ///< Момент першого відтвореного тіку
+unsigned long replayLastMs = 0;           ///< Момент останнього відтвореного тіку
+bool buttonWasPressed = false;            ///< Стан кнопки на попередньому тіку
+
+#ifdef SCOPE_MODE
+/**
+ * @brief Швидкість порту в режимі осцилографа (точна при 16 МГц).
+ */
+const unsigned long SERIAL_BAUD = 500000;
+
+/**
+ * @brief Частота вибірок потенціометра в режимі осцилографа (Гц).
+ */
+const uint16_t SCOPE_RATE_HZ = 5000;
+#else
+const unsigned long SERIAL_BAUD = 9600;
+#endif
 
 // ----------------------------------------------------------
 //                   ІНІЦІАЛІЗАЦІЯ
@@ -76,72 +159,288 @@ int lastAngle = -1;   ///< Збережений попередній кут дл
  * Встановлює швидкість передачі даних 9600 бод,
  * приєднує сервопривід до вказаного піна
  * та виводить коротку інформацію для користувача.
+ * У режимі осцилографа замість тексту одразу запускаються вибірки.
  */
 void setup() {
-  Serial.begin(9600);
+  Serial.begin(SERIAL_BAUD);
   myServo.attach(SERVO_PIN);
 
+#ifdef SCOPE_MODE
+  ScopeBegin(POT_PIN, SCOPE_RATE_HZ);
+  nextSampleMs = millis();
+  return;
+#endif
+
   Serial.println("====================================================");
   Serial.println(" 🧭  Система керування сервоприводом потенціометром ");
   Serial.println("====================================================");
   Serial.println("Поверніть ручку потенціометра, щоб змінити кут сервоприводу.");
-  Serial.println("Дані оновлюються лише при зміні кута більше ніж на 5°.\n");
+  Serial.println("Дані оновлюються лише при зміні кута більше ніж на 5°.");
+  Serial.println("Запис руху: r — запис, s — стоп, p — відтворити, l — по колу, кнопка D2 — відтворити.");
+  Serial.println("Звіт про пам'ять: m, час етапів обробки: t.\n");
+
+  pinMode(BUTTON_PIN, INPUT_PULLUP);
+  IdleWakeOnPin(BUTTON_PIN);
+  IdleWakeOnSerial(Serial);
+
+  MemDiagReport(Serial, F("після setup()"));
   delay(1000);
+  nextSampleMs = millis();
 }
 
 // ----------------------------------------------------------
-//                ДОПОМІЖНА ФУНКЦІЯ ВИВОДУ
+//               ЗАПИС І ВІДТВОРЕННЯ ТРАЄКТОРІЇ
 // ----------------------------------------------------------
 
 /**
- * @brief Виводить поточний кут сервоприводу у Serial Monitor у графічному вигляді.
+ * @brief Починає запис траєкторії з поточного кута.
+ */
+void StartRecording(int angle) {
+  recordDeadband.Reset(angle);
+  recorder.Begin(SAMPLE_PERIOD_MS, angle);
+  mode = MODE_RECORD;
+  Serial.println("⏺  Запис почато");
+}
+
+/**
+ * @brief Завершує запис і виводить стиснення та швидкість запису.
  *
- * Ця функція створює шкалу з MAX_SEGMENT сегментів, яка показує поточне положення
- * сервоприводу. Кількість заповнених сегментів відповідає куту повороту.
+ * Без стиснення кожен тік займав би 1 байт; коефіцієнт стиснення —
+ * це кількість тіків на один байт EEPROM.
+ */
+void StopRecording() {
+  recorder.End();
+  mode = MODE_LIVE;
+
+  unsigned long ms = (unsigned long)recorder.Ticks() * SAMPLE_PERIOD_MS;
+  Serial.print("⏹  Запис завершено: ");
+  Serial.print(recorder.Ticks());
+  Serial.print(" тіків, ");
+  Serial.print(ms / 1000.0, 1);
+  Serial.print(" с, ");
+  Serial.print(recorder.Bytes());
+  Serial.print(" з ");
+  Serial.print(recorder.Capacity());
+  Serial.println(" байтів EEPROM");
+
+  Serial.print("   Стиснення: ");
+  Serial.print((float)recorder.Ticks() / recorder.Bytes(), 2);
+  Serial.print("x, потік: ");
+  Serial.print(recorder.Bytes() * 1000.0 / ms, 1);
+  Serial.println(" байт/с\n");
+}
+
+/**
+ * @brief Починає відтворення запису з EEPROM.
  *
- * @param angle Поточний кут сервоприводу (0–180°).
+ * @param loop true — відтворювати по колу до команди «стоп».
  */
-void PrintAngleChange(int angle) {
-  // Оновлення лише при значній зміні
-  if (abs(angle - lastAngle) >= ANGLE_TOLERANCE) {
-        lastAngle = angle;        // Оновлення попереднього значення
-        Serial.print("Кут: ");
-        Serial.print(angle);
-        Serial.print("° \t[");
+void StartReplay(bool loop) {
+  if (mode == MODE_RECORD) StopRecording();
+
+  if (!player.Begin()) {
+    Serial.println("❌ У EEPROM немає запису.");
+    mode = MODE_LIVE;
+    return;
+  }
+
+  mode = MODE_REPLAY;
+  replayLoop = loop;
+  replayTicks = 0;
+  Serial.print("▶  Відтворення: ");
+  Serial.print(player.Ticks());
+  Serial.print(" тіків по ");
+  Serial.print(player.TickMs());
+  Serial.println(" мс");
+}
 
-  // Розрахунок кількості заповнених сегментів
-        int filled = map(angle, MIN_ANGLE, MAX_ANGLE, 0, MAX_SEGMENT);
-        for (int i = 0; i < MAX_SEGMENT; i++) {
-          if (i < filled) Serial.print("#");
-          else Serial.print("-");
-        }
+/**
+ * @brief Зупиняє відтворення і порівнює фактичну тривалість із записаною.
+ *
+ * Час вимірюється між першим і останнім відтвореним тіком, тож різниця
+ * показує лише накопичену похибку розкладу.
+ */
+void StopReplay() {
+  unsigned long elapsed = replayLastMs - replayFirstMs;
+  unsigned long expected = replayTicks ? (replayTicks - 1) * player.TickMs() : 0;
+  mode = MODE_LIVE;
 
-        Serial.println("]");
-      }
+  Serial.print("⏹  Відтворено ");
+  Serial.print(replayTicks);
+  Serial.print(" тіків за ");
+  Serial.print(elapsed);
+  Serial.print(" мс (за записом ");
+  Serial.print(expected);
+  Serial.println(" мс)\n");
 }
 
 // ----------------------------------------------------------
-//                   ІНІЦІАЛІЗАЦІЯ
+//                     ЕТАПИ КОНВЕЄРА
 // ----------------------------------------------------------
 
 /**
- * @brief Ініціалізація Serial Monitor та серво.
+ * @brief Джерело: значення потенціометра 0–1023 на кожному тіку.
  *
- * Встановлює швидкість передачі даних 9600 бод,
- * приєднує сервопривід до вказаного піна
- * та виводить коротку інформацію для користувача.
+ * Зазвичай — вимірювання у сні ADC Noise Reduction у паузі між імпульсами
+ * сервоприводу; у режимі осцилографа АЦП належить таймеру вибірок, тож
+ * береться остання вибірка.
  */
-void setup() {
-  Serial.begin(9600);
-  myServo.attach(SERVO_PIN);
+struct PotSource {
+  typedef int Output;
 
-  Serial.println("====================================================");
-  Serial.println(" 🧭  Система керування сервоприводом потенціометром ");
-  Serial.println("====================================================");
-  Serial.println("Поверніть ручку потенціометра, щоб змінити кут сервоприводу.");
-  Serial.println("Дані оновлюються лише при зміні кута більше ніж на 5°.\n");
-  delay(1000);
+  bool Poll(int &out) {
+#ifdef SCOPE_MODE
+    out = ScopeLatest();
+#else
+    out = IdleAnalogRead(POT_PIN, SERVO_PIN);
+#endif
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("pot"); }
+};
+
+/**
+ * @brief Запис траєкторії: під час запису придушує тремтіння і додає кут в EEPROM.
+ *
+ * В інших режимах кут проходить без змін.
+ */
+struct RecordStage {
+  typedef int Output;
+
+  bool Process(const int &in, int &out) {
+    out = in;
+    if (mode != MODE_RECORD) return true;
+
+    // Дрібне тремтіння потенціометра не записується і не передається на серво
+    recordDeadband.Process(in, out);
+    if (!recorder.Add(out)) {
+      Serial.println("⚠  EEPROM заповнено.");
+      StopRecording();
+    }
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("record"); }
+};
+
+/**
+ * @brief Виконавчий пристрій: сервопривід.
+ */
+struct ServoStage {
+  typedef int Output;
+
+  bool Process(const int &in, int &out) {
+    servoAngle = in;
+    myServo.write(in);
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("servo"); }
+};
+
+/**
+ * @brief Вивід кута зі шкалою з MAX_SEGMENT поділок одним записом у порт.
+ */
+struct GaugeStage {
+  typedef int Output;
+
+  bool Process(const int &in, int &out) {
+    GaugePrint(Serial, ANGLE_GAUGE, in, MIN_ANGLE, MAX_ANGLE);
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("gauge"); }
+};
+
+PotSource pot;                                      ///< Потенціометр
+MapStage toAngle(0, 1023, MIN_ANGLE, MAX_ANGLE);    ///< Сигнал → кут
+ServoStage servoStage;                              ///< Сервопривід
+
+#ifdef SCOPE_MODE
+/**
+ * @brief Конвеєр режиму осцилографа: без запису і без тексту в порт.
+ */
+Pipeline<PotSource, MapStage, ServoStage> pipeline(pot, toAngle, servoStage);
+#else
+RecordStage recordStage;                            ///< Запис траєкторії
+ChangeFilter printFilter(ANGLE_TOLERANCE);          ///< Вивід лише при значній зміні
+GaugeStage gaugeStage;                              ///< Шкала у порт
+
+/**
+ * @brief Номер етапу запису — вхід для відтворених кутів.
+ */
+const uint8_t RECORD_STAGE = 2;
+
+/**
+ * @brief Конвеєр: потенціометр → кут → запис → серво → фільтр змін → шкала.
+ */
+Pipeline<PotSource, MapStage, RecordStage, ServoStage, ChangeFilter, GaugeStage>
+  pipeline(pot, toAngle, recordStage, servoStage, printFilter, gaugeStage);
+#endif
+
+/**
+ * @brief Обробляє односимвольні команди з терміналу.
+ */
+void HandleCommands() {
+  while (Serial.available()) {
+    char command = Serial.read();
+    switch (command) {
+      case 'r':
+        if (mode == MODE_REPLAY) StopReplay();
+        if (mode == MODE_LIVE) StartRecording(servoAngle);
+        break;
+      case 's':
+        if (mode == MODE_RECORD) StopRecording();
+        else if (mode == MODE_REPLAY) StopReplay();
+        break;
+      case 'p': StartReplay(false); break;
+      case 'l': StartReplay(true); break;
+      case 'm': MemDiagReport(Serial, F("за запитом")); break;
+      case 't': pipeline.Report(Serial); break;
+      default: break;  // Кінці рядків та інше ігноруються
+    }
+  }
+}
+
+/**
+ * @brief Кнопка D2: натискання запускає або зупиняє відтворення.
+ *
+ * Опитується раз на тік (20 мс), що водночас усуває брязкіт контактів.
+ */
+void HandleButton() {
+  bool pressed = digitalRead(BUTTON_PIN) == LOW;
+  if (pressed && !buttonWasPressed) {
+    if (mode == MODE_REPLAY) StopReplay();
+    else StartReplay(false);
+  }
+  buttonWasPressed = pressed;
 }
+
+/**
+ * @brief Кут наступного тіку у режимі відтворення.
+ *
+ * @return false, якщо запис закінчився і відтворення зупинено.
+ */
+bool NextReplayAngle(int &angle) {
+  uint8_t value;
+  if (!player.Next(value)) {
+    if (!replayLoop) {
+      StopReplay();
+      return false;
+    }
+    player.Begin();
+    player.Next(value);
+  }
+
+  replayLastMs = millis();
+  if (replayTicks++ == 0) replayFirstMs = replayLastMs;
+  angle = value;
+  return true;
+}
+
 // ----------------------------------------------------------
 //                     ОСНОВНИЙ ЦИКЛ
 // ----------------------------------------------------------
@@ -149,19 +448,41 @@ void setup() {
 /**
  * @brief Основний цикл програми.
  *
- * У кожній ітерації програма зчитує поточне значення потенціометра,
- * перетворює його у кут сервоприводу, і якщо зміна перевищує поріг,
- * оновлює положення серво та вивід у монітор порту.
+ * На кожному тіку конвеєр зчитує потенціометр, перетворює значення в кут,
+ * виставляє сервопривід і, якщо кут змінився більше ніж на поріг,
+ * виводить його у монітор порту. Під час відтворення кут із запису
+ * подається одразу в етап запису, а потенціометр не опитується.
+ *
+ * Між вимірюваннями мікроконтролер спить до наступного тіку, а саме
+ * вимірювання виконується в режимі ADC Noise Reduction у паузі між
+ * імпульсами сервоприводу.
+ *
+ * У режимі осцилографа АЦП належить таймеру вибірок: заповнені блоки
+ * відправляються, щойно готові, а кут береться з останньої вибірки.
  */
 void loop() {
-  // Зчитування аналогового сигналу з потенціометра
-  int potValue = analogRead(POT_PIN);
-
-  // Перетворення сигналу в кут сервоприводу MIN_ANGLE, MAX_ANGLE
-  int angle = map(potValue, 0, 1023, MIN_ANGLE, MAX_ANGLE);
-
-  myServo.write(angle);     // Встановлення нового кута
-  PrintAngleChange(angle);  // Вивід у монітор порту
+#ifdef SCOPE_MODE
+  if (IdleUntil(nextSampleMs + SAMPLE_PERIOD_MS, ScopeFrameReady)) {
+    ScopeService(Serial);
+    return;
+  }
+  nextSampleMs += SAMPLE_PERIOD_MS;
+  pipeline.Run();
+#else
+  // Сон до наступного тіку (замість delay()); команди обробляються одразу
+  unsigned long tick = (mode == MODE_REPLAY) ? player.TickMs() : SAMPLE_PERIOD_MS;
+  if (IdleUntil(nextSampleMs + tick)) {
+    HandleCommands();
+    return;
+  }
+  nextSampleMs += tick;
+  HandleButton();
 
-  delay(50); // Невелика пауза для стабільності
+  int angle;
+  if (mode == MODE_REPLAY && NextReplayAngle(angle)) {
+    pipeline.Feed<RECORD_STAGE>(angle);  // Кут береться із запису
+  } else {
+    pipeline.Run();
+  }
+#endif
 }
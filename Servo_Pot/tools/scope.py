@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Прийом і відновлення сигналу потенціометра з режиму осцилографа Servo_Pot.
+
+Скрипт читає потік кадрів з плати (середовище uno_scope) або з файлу,
+синхронізується за байтами 0xA5 0x5A, перевіряє контрольну суму,
+розпаковує 10-бітні вибірки та відновлює сигнал у часі. Пропуски в
+номерах кадрів означають відкинуті платою блоки (не встигла відправити)
+або кадри, втрачені чи пошкоджені в лінії; на їхньому місці у сигналі
+залишається розрив потрібної довжини.
+
+Приклади:
+    python scope.py --port /dev/ttyACM0 --seconds 5           # статистика за 5 с
+    python scope.py --port /dev/ttyACM0 --raw capture.bin     # зберегти сирий потік
+    python scope.py --file capture.bin --csv signal.csv       # час і значення у CSV
+    python scope.py --file capture.bin --plot                 # графік (matplotlib)
+
+Формат кадру описано у include/Scope.h.
+"""
+
+import argparse
+import math
+import sys
+import time
+
+SYNC = b"\xA5\x5A"
+DEFAULT_RATE = 5000
+DEFAULT_BAUD = 500000
+VREF = 5.0
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+def unpack(payload, count):
+    """Розпаковує count 10-бітних вибірок (групи по 4 вибірки у 5 байтах)."""
+    samples = []
+    for g in range(0, count // 4):
+        chunk = payload[g * 5:g * 5 + 5]
+        high = chunk[4]
+        for k in range(4):
+            samples.append(chunk[k] | (((high >> (2 * k)) & 0x03) << 8))
+    return samples
+
+
+class FrameReader:
+    """Виділяє кадри з потоку байтів, пропускаючи текст і сміття між ними."""
+
+    def __init__(self, stream, deadline=None):
+        self.stream = stream
+        self.deadline = deadline
+        self.buffer = bytearray()
+        self.bad_checksum = 0
+        self.skipped_bytes = 0
+
+    def _fill(self):
+        if self.deadline is not None and time.monotonic() >= self.deadline:
+            return False
+        chunk = self.stream.read(4096)
+        if not chunk:
+            # Файл закінчився; серійний порт з тайм-аутом просто чекає далі
+            return hasattr(self.stream, "in_waiting")
+        self.buffer.extend(chunk)
+        return True
+
+    def frames(self):
+        """Повертає (seq, samples) для кожного цілого кадру."""
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                keep = 1 if self.buffer.endswith(SYNC[:1]) else 0
+                self.skipped_bytes += len(self.buffer) - keep
+                del self.buffer[:len(self.buffer) - keep]
+                if not self._fill():
+                    return
+                continue
+            if start:
+                self.skipped_bytes += start
+                del self.buffer[:start]
+
+            if len(self.buffer) < 4:
+                if not self._fill():
+                    return
+                continue
+
+            seq, count = self.buffer[2], self.buffer[3]
+            length = 4 + count // 4 * 5 + 2
+            if count % 4 or count == 0:
+                # Це не заголовок, а випадковий збіг у даних
+                self.skipped_bytes += 1
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < length:
+                if not self._fill():
+                    return
+                continue
+
+            frame = bytes(self.buffer[:length])
+            if fletcher16(frame[2:-2]) != (frame[-2], frame[-1]):
+                self.bad_checksum += 1
+                self.skipped_bytes += 1
+                del self.buffer[:1]
+                continue
+
+            del self.buffer[:length]
+            yield seq, unpack(frame[4:-2], count)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("--port", help="серійний порт плати")
+    group.add_argument("--file", help="файл із захопленим потоком")
+    parser.add_argument("--baud", type=int, default=DEFAULT_BAUD)
+    parser.add_argument("--rate", type=float, default=DEFAULT_RATE, help="частота вибірок, Гц (SCOPE_RATE_HZ)")
+    parser.add_argument("--seconds", type=float, help="тривалість прийому з порту")
+    parser.add_argument("--raw", help="зберегти сирий потік у файл")
+    parser.add_argument("--csv", help="зберегти час (с) і значення у CSV")
+    parser.add_argument("--plot", action="store_true", help="показати графік сигналу")
+    args = parser.parse_args()
+
+    if args.port:
+        import serial  # pyserial
+        stream = serial.Serial(args.port, args.baud, timeout=0.2)
+        stream.reset_input_buffer()
+    else:
+        stream = open(args.file, "rb")
+
+    if args.raw:
+        raw = open(args.raw, "wb")
+        read = stream.read
+
+        def tee(n):
+            data = read(n)
+            raw.write(data)
+            return data
+        stream.read = tee
+
+    deadline = time.monotonic() + args.seconds if args.seconds else None
+    reader = FrameReader(stream, deadline)
+
+    signal = []        # значення або None на місці втрачених вибірок
+    frames = 0
+    lost = 0
+    last_seq = None
+    block = None
+
+    try:
+        for seq, samples in reader.frames():
+            block = len(samples)
+            if last_seq is not None:
+                gap = (seq - last_seq - 1) % 256
+                if gap:
+                    lost += gap
+                    signal.extend([None] * (gap * block))
+            last_seq = seq
+            frames += 1
+            signal.extend(samples)
+    except KeyboardInterrupt:
+        pass
+
+    if frames == 0:
+        print("Кадрів не знайдено (пропущено байтів: %d)" % reader.skipped_bytes)
+        sys.exit(1)
+
+    values = [v for v in signal if v is not None]
+    n = len(values)
+    mean = sum(values) / n
+    std = math.sqrt(sum((v - mean) ** 2 for v in values) / n)
+    lo, hi = min(values), max(values)
+
+    print("Кадрів прийнято: %d, втрачено (пропуски номерів): %d (%.2f%%)"
+          % (frames, lost, 100.0 * lost / (frames + lost)))
+    print("Пошкоджених кадрів: %d, пропущено байтів: %d" % (reader.bad_checksum, reader.skipped_bytes))
+    print("Вибірок: %d (%.3f с при %.0f Гц)" % (n, len(signal) / args.rate, args.rate))
+    print("Середнє: %.1f (%.3f В), СКВ шуму: %.2f МЗР" % (mean, mean * VREF / 1023, std))
+    print("Мінімум: %d, максимум: %d, розмах: %d МЗР (%.1f мВ)" % (lo, hi, hi - lo, (hi - lo) * VREF / 1023 * 1000))
+
+    if args.csv:
+        with open(args.csv, "w") as f:
+            f.write("t,value\n")
+            for i, v in enumerate(signal):
+                f.write("%.6f,%s\n" % (i / args.rate, "" if v is None else v))
+
+    if args.plot:
+        import matplotlib.pyplot as plt
+        t = [i / args.rate for i in range(len(signal))]
+        y = [float("nan") if v is None else v for v in signal]
+        plt.plot(t, y, linewidth=0.7)
+        plt.xlabel("час, с")
+        plt.ylabel("АЦП, МЗР")
+        plt.title("Сигнал потенціометра (%d кадрів, втрачено %d)" % (frames, lost))
+        plt.grid(True)
+        plt.show()
+
+
+if __name__ == "__main__":
+    main()
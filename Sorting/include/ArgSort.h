@@ -0,0 +1,199 @@
+/**
+ * @file ArgSort.h
+ * @brief Сортування записів через масив індексів із подальшою перестановкою на місці.
+ *
+ * BubbleSort_Mon() та BubbleSortEngine переставляють самі значення int. Для
+ * записів (час, канал, значення) кожен обмін на AVR — це копіювання 7+
+ * байтів через регістри, тож сортувати їх напряму дорого. Тут сортується
+ * лише масив індексів order[] (1 байт на запис для n ≤ 256, 2 — для більших),
+ * а записи читаються тільки для порівняння:
+ *
+ * 1. ArgSort() впорядковує order[] так, що items[order[0]] — перший запис,
+ *    items[order[1]] — другий тощо. Записи не переміщуються.
+ * 2. За потреби ApplyPermutation() переставляє самі записи за order[] на
+ *    місці, слідуючи циклам перестановки: кожен запис копіюється рівно
+ *    один раз, плюс одне тимчасове копіювання на цикл — не більше
+ *    n + n/2 переміщень замість O(n²) обмінів.
+ *
+ * Сортування індексів — пірамідальне (heapsort): O(n log n) порівнянь,
+ * без рекурсії та без додаткової пам’яті. Стабільний режим (ARGSORT_STABLE)
+ * при рівних ключах порівнює самі індекси — а вони і є початковим
+ * порядком записів, тож рівні записи зберігають взаємний порядок без
+ * окремого алгоритму і без додаткової пам’яті.
+ *
+ * Функція порівняння — будь-що, що викликається як less(const T&, const T&):
+ * функція або функтор. Тип порівняння — параметр шаблону, тож функтор
+ * вбудовується в цикл сортування, а не викликається за вказівником.
+ *
+ * @example
+ *  struct Sample { uint32_t time; uint8_t channel; int16_t value; };
+ *  bool ByChannel(const Sample &a, const Sample &b) { return a.channel < b.channel; }
+ *
+ *  Sample samples[40];
+ *  uint8_t order[40];
+ *  ArgSort(samples, order, 40, ByChannel, ARGSORT_STABLE);  // у межах каналу — за часом
+ *  ApplyPermutation(samples, order, 40);                    // order[] після цього — тотожна
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef ARGSORT_H
+#define ARGSORT_H
+
+#include <stdint.h>
+
+/**
+ * @brief Режим сортування індексів.
+ */
+enum ArgSortMode
+{
+  ARGSORT_UNSTABLE,  ///< Рівні записи можуть змінити взаємний порядок (менше порівнянь)
+  ARGSORT_STABLE     ///< Рівні записи зберігають початковий порядок
+};
+
+/**
+ * @brief Чи вміщує тип індексу Index номери 0..count-1.
+ */
+template <typename Index>
+inline bool ArgSortFits(uint16_t count)
+{
+  return count == 0 || (uint16_t)(count - 1) <= (Index)~(Index)0;
+}
+
+/**
+ * @brief Порівняння за operator< (для ArgSort() без власної функції).
+ */
+template <typename T>
+inline bool ArgSortLess(const T &a, const T &b)
+{
+  return a < b;
+}
+
+/**
+ * @brief Службові функції ArgSort() (не для прямого виклику).
+ */
+namespace ArgSortDetail
+{
+  /**
+   * @brief Чи має запис із індексом a стояти перед записом з індексом b.
+   */
+  template <typename T, typename Index, typename Less>
+  inline bool Before(const T items[], Index a, Index b, Less less, bool stable)
+  {
+    if (less(items[a], items[b])) return true;
+    if (!stable || less(items[b], items[a])) return false;
+    return a < b;  // Рівні ключі — початковий порядок
+  }
+
+  /**
+   * @brief Опускає елемент root у піраміді order[0..count-1] на своє місце.
+   */
+  template <typename T, typename Index, typename Less>
+  void SiftDown(const T items[], Index order[], uint16_t root, uint16_t count,
+                Less less, bool stable)
+  {
+    Index value = order[root];
+    for (;;)
+    {
+      uint16_t child = 2 * root + 1;
+      if (child >= count) break;
+      if (child + 1 < count && Before(items, order[child], order[child + 1], less, stable))
+      {
+        child++;
+      }
+      if (!Before(items, value, order[child], less, stable)) break;
+      order[root] = order[child];  // Зсуваємо нащадка вгору замість обміну
+      root = child;
+    }
+    order[root] = value;
+  }
+}
+
+/**
+ * @brief Сортує індекси записів, не переміщуючи самих записів.
+ *
+ * @param items  Записи (лише читаються).
+ * @param order  Масив індексів на count елементів; початковий вміст не
+ *               важливий — функція заповнює його 0..count-1 сама.
+ * @param count  Кількість записів.
+ * @param less   Порівняння: true, якщо a має стояти перед b.
+ * @param mode   ARGSORT_STABLE — зберегти порядок рівних записів.
+ * @return false, якщо count не вміщується в тип Index (order[] не змінено).
+ */
+template <typename T, typename Index, typename Less>
+bool ArgSort(const T items[], Index order[], uint16_t count, Less less,
+             ArgSortMode mode = ARGSORT_UNSTABLE)
+{
+  if (!ArgSortFits<Index>(count)) return false;
+
+  bool stable = (mode == ARGSORT_STABLE);
+  for (uint16_t i = 0; i < count; i++) order[i] = (Index)i;
+  if (count < 2) return true;
+
+  // Піраміда з найбільшим записом у корені, далі корінь — у кінець
+  for (uint16_t i = count / 2; i-- > 0;)
+  {
+    ArgSortDetail::SiftDown(items, order, i, count, less, stable);
+  }
+  for (uint16_t end = count - 1; end > 0; end--)
+  {
+    Index top = order[0];
+    order[0] = order[end];
+    order[end] = top;
+    ArgSortDetail::SiftDown(items, order, 0, end, less, stable);
+  }
+  return true;
+}
+
+/**
+ * @brief Сортує індекси за зростанням (operator< типу T).
+ */
+template <typename T, typename Index>
+bool ArgSort(const T items[], Index order[], uint16_t count,
+             ArgSortMode mode = ARGSORT_UNSTABLE)
+{
+  return ArgSort(items, order, count, ArgSortLess<T>, mode);
+}
+
+/**
+ * @brief Переставляє записи на місці так, що items[i] стає колишнім items[order[i]].
+ *
+ * Обхід циклів перестановки: запис на початку циклу зберігається в одній
+ * тимчасовій змінній, решта записів циклу зсуваються на свої місця по
+ * одному разу. Пройдені позиції позначаються в самому order[], тож
+ * додаткової пам’яті не потрібно, а order[] після виклику стає тотожною
+ * перестановкою (0, 1, 2, …). Щоб переставити за тим самим порядком
+ * кілька паралельних масивів, кожному передайте копію order[].
+ *
+ * @param items Записи для перестановки.
+ * @param order Перестановка (наприклад, результат ArgSort()); руйнується.
+ * @param count Кількість записів.
+ * @return Кількість копіювань записів (разом із тимчасовими).
+ */
+template <typename T, typename Index>
+uint16_t ApplyPermutation(T items[], Index order[], uint16_t count)
+{
+  uint16_t moves = 0;
+  for (uint16_t start = 0; start < count; start++)
+  {
+    if (order[start] == start) continue;  // На місці або цикл уже пройдено
+
+    T saved = items[start];
+    uint16_t hole = start;
+    for (;;)
+    {
+      uint16_t next = order[hole];
+      order[hole] = (Index)hole;
+      if (next == start) break;
+      items[hole] = items[next];
+      moves++;
+      hole = next;
+    }
+    items[hole] = saved;
+    moves += 2;  // Збереження і повернення запису з початку циклу
+  }
+  return moves;
+}
+
+#endif  // ARGSORT_H
@@ -0,0 +1,117 @@
+/**
+ * @file BubbleSortEngine.h
+ * @brief Покроковий (відновлюваний) варіант сортування методом «Бульбашки».
+ *
+ * BubbleSort_Mon() виконує сортування повністю за один виклик, і поки воно
+ * триває, loop() не може обслуговувати Serial чи інші задачі. BubbleSortEngine
+ * зберігає стан алгоритму (номер проходу, поточну пару, прапорець обміну)
+ * між викликами, тому сортування можна просувати невеликими порціями:
+ * - Step()        — одне порівняння (і, за потреби, обмін);
+ * - RunSteps(n)   — не більше n порівнянь;
+ * - RunFor(us)    — стільки порівнянь, скільки вміщується у бюджет часу.
+ *
+ * Якщо підключено SortTrace, кожне порівняння й обмін записуються як
+ * компактна двійкова подія замість виводу всього масиву. Поки в буфері
+ * запису немає місця на події кроку, кроки не виконуються (повертається
+ * «не завершено»), тож сортування ніколи не чекає на порт.
+ *
+ * @example
+ *  BubbleSortEngine engine;
+ *  engine.Begin(data, size);
+ *  // у loop():
+ *  if (!engine.IsDone()) engine.RunFor(1000); // не довше ~1 мс за прохід loop()
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef BUBBLESORTENGINE_H
+#define BUBBLESORTENGINE_H
+
+#include <Arduino.h>
+#include "SortCompare.h"
+#include "SortTrace.h"
+
+/**
+ * @brief Скінченний автомат сортування «Бульбашкою», що просувається порціями.
+ */
+class BubbleSortEngine
+{
+public:
+  BubbleSortEngine();
+
+  /**
+   * @brief Підключає запис подій (або відключає, якщо trace == NULL).
+   *
+   * Викликається до Begin(): Begin() записує початковий стан масиву,
+   * а завершення сортування — подію кінця запису.
+   */
+  void SetTrace(SortTrace *trace) { _trace = trace; }
+
+  /**
+   * @brief Задає порядок сортування (NULL — за зростанням, найшвидший варіант).
+   */
+  void SetCompare(SortLess less) { _less = less; }
+
+  /**
+   * @brief Починає нове сортування масиву (попередній стан скидається).
+   *
+   * @param arr  Масив цілих чисел, який потрібно відсортувати на місці.
+   * @param size Кількість елементів у масиві.
+   */
+  void Begin(int arr[], int size);
+
+  /**
+   * @brief Виконує одне порівняння сусідніх елементів і, за потреби, обмін.
+   *
+   * @return true, якщо сортування ще не завершено.
+   */
+  bool Step();
+
+  /**
+   * @brief Виконує не більше maxSteps порівнянь.
+   *
+   * @param maxSteps Максимальна кількість порівнянь за виклик.
+   * @return true, якщо сортування ще не завершено.
+   */
+  bool RunSteps(unsigned int maxSteps);
+
+  /**
+   * @brief Виконує порівняння, доки не вичерпано бюджет часу.
+   *
+   * Час перевіряється через кожні STEPS_PER_CHECK порівнянь, тому бюджет
+   * може бути перевищено лише на кілька порівнянь (одиниці мікросекунд).
+   * Якщо буфер запису подій заповнено, виклик завершується раніше.
+   *
+   * @param budgetUs Бюджет часу у мікросекундах.
+   * @return true, якщо сортування ще не завершено.
+   */
+  bool RunFor(unsigned long budgetUs);
+
+  bool IsDone() const { return _done; }                 ///< Чи завершено сортування
+  int Pass() const { return _pass + 1; }                ///< Номер поточного проходу (з 1)
+  unsigned long Comparisons() const { return _compares; } ///< Кількість виконаних порівнянь
+  unsigned long Swaps() const { return _swaps; }        ///< Кількість виконаних обмінів
+
+private:
+  static const unsigned int STEPS_PER_CHECK = 8;
+  static const uint8_t TRACE_STEP_BYTES = 2 * TRACE_MAX_EVENT_BYTES + 1; ///< Порівняння, обмін і кінець
+
+  /**
+   * @brief Чи бракує місця в буфері запису на події одного кроку.
+   */
+  bool TraceBlocked() const { return _trace != NULL && !_trace->HasRoom(TRACE_STEP_BYTES); }
+
+  int *_arr;               ///< Масив, що сортується
+  int _size;               ///< Розмір масиву
+  int _pass;               ///< Номер поточного проходу (з 0)
+  int _j;                  ///< Індекс лівого елемента поточної пари
+  bool _swapped;           ///< Чи був обмін у поточному проході
+  bool _done;              ///< Ознака завершення
+  unsigned long _compares; ///< Лічильник порівнянь
+  unsigned long _swaps;    ///< Лічильник обмінів
+  SortTrace *_trace;       ///< Запис подій (необов’язковий)
+  SortLess _less;          ///< Функція порівняння (NULL — за зростанням)
+};
+
+#endif  // BUBBLESORTENGINE_H
@@ -0,0 +1,42 @@
+/**
+ * @file ParallelSort.h
+ * @brief Паралельне сортування злиттям для збірки на комп’ютері (середовище native).
+ *
+ * На Arduino сортуються десятки елементів, а на комп’ютері ті самі алгоритми
+ * отримують записи з мільйонів вибірок. Тут масив ділиться навпіл рекурсивно,
+ * половини сортуються паралельно на пулі потоків з перехопленням задач
+ * (work stealing), а злиття теж розпаралелюється: більша половина ділиться
+ * посередині, а відповідна точка в меншій шукається двійковим пошуком.
+ *
+ * Функцію порівняння (SortLess) і запис подій (SortTrace) використовують
+ * ті самі, що й вбудовані алгоритми. Оскільки злиття переносить елементи
+ * через допоміжний буфер, у запис потрапляють події TRACE_TAG_SET для
+ * кожної зміни основного масиву (порівняння не записуються).
+ *
+ * Лише для комп’ютера: потрібні <thread> та C++11.
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef PARALLELSORT_H
+#define PARALLELSORT_H
+
+#include <stddef.h>
+#include "SortCompare.h"
+#include "SortTrace.h"
+
+/**
+ * @brief Сортує масив паралельним злиттям.
+ *
+ * @param data    Масив для сортування на місці.
+ * @param size    Кількість елементів.
+ * @param threads Кількість потоків (0 — за кількістю ядер; 1 — без пулу).
+ * @param less    Функція порівняння (NULL — за зростанням).
+ * @param trace   Запис подій (NULL — без запису). Записування серіалізується
+ *                м’ютексом і для великих масивів суттєво сповільнює сортування.
+ */
+void ParallelSort(int data[], size_t size, unsigned threads,
+                  SortLess less = NULL, SortTrace *trace = NULL);
+
+#endif  // PARALLELSORT_H
@@ -0,0 +1,33 @@
+/**
+ * @file SortCompare.h
+ * @brief Спільний інтерфейс порівняння для всіх алгоритмів сортування проєкту.
+ *
+ * Вбудовані алгоритми (BubbleSortEngine) і паралельне сортування на
+ * комп’ютері (ParallelSort) приймають однакову функцію «менше», тож
+ * порядок сортування задається в одному місці й однаково працює всюди.
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef SORTCOMPARE_H
+#define SORTCOMPARE_H
+
+/**
+ * @brief Функція порівняння: повертає true, якщо a має стояти перед b.
+ *
+ * Має задавати строгий слабкий порядок (як operator< для чисел).
+ */
+typedef bool (*SortLess)(int a, int b);
+
+/**
+ * @brief Порівняння за зростанням (порядок за замовчуванням).
+ */
+inline bool SortAscending(int a, int b) { return a < b; }
+
+/**
+ * @brief Порівняння за спаданням.
+ */
+inline bool SortDescending(int a, int b) { return b < a; }
+
+#endif  // SORTCOMPARE_H
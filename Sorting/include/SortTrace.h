@@ -0,0 +1,122 @@
+/**
+ * @file SortTrace.h
+ * @brief Компактний двійковий запис подій сортування (порівняння та обміни).
+ *
+ * Замість виводу всього масиву після кожного обміну (O(n) байтів на подію)
+ * сортування повідомляє лише індекси пари, що порівнюється або обмінюється.
+ * Події кодуються varint-ами у кільцевий буфер, який поступово
+ * вивантажується у Serial. Скрипт tools/sort_replay.py на комп’ютері
+ * відтворює події на початковому масиві й відновлює кожен проміжний стан.
+ *
+ * Запис ніколи не чекає на приймач: той, хто пише події з обмеженим часом
+ * (BubbleSortEngine), спершу перевіряє HasRoom(), а буфер вивантажується з
+ * loop() через Drain().
+ *
+ * Формат потоку:
+ * - Заголовок: 'S' 'T' 'R' '1', varint n, далі n значень (zigzag varint).
+ * - Подія:     байт тегу, varint i, [varint j].
+ *              Молодший біт тегу = 1 означає j == i + 1 (j не передається),
+ *              тож обмін сусідів у «Бульбашці» займає лише 2 байти.
+ * - Запис:     TRACE_TAG_SET, varint i, значення (zigzag varint) —
+ *              для алгоритмів, що переносять елементи через буфер (злиття).
+ * - Кінець:    TRACE_TAG_END.
+ *
+ * Файл не залежить від Arduino.h — той самий код використовується і на комп’ютері.
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef SORTTRACE_H
+#define SORTTRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+const uint8_t TRACE_TAG_COMPARE = 0xC0; ///< Порівняння пари (i, j)
+const uint8_t TRACE_TAG_SWAP    = 0xD0; ///< Обмін пари (i, j)
+const uint8_t TRACE_TAG_SET     = 0xB0; ///< Запис значення в arr[i]
+const uint8_t TRACE_TAG_END     = 0xE0; ///< Кінець запису
+const uint8_t TRACE_TAG_NEXT    = 0x01; ///< Прапорець тегу: j == i + 1
+
+const uint8_t TRACE_MAX_EVENT_BYTES = 7; ///< Найдовша подія порівняння/обміну: тег і два varint по 3 байти
+const uint8_t TRACE_MAX_VALUE_BYTES = 5; ///< Найдовше значення (zigzag varint 32 біт)
+
+/**
+ * @brief Приймач байтів запису (наприклад, обгортка над Serial.write).
+ *
+ * Має приймати стільки байтів, скільки може без очікування, і повертати
+ * їх кількість — так вивантаження ніколи не блокує loop().
+ */
+typedef size_t (*SortTraceSink)(const uint8_t *data, size_t len);
+
+/**
+ * @brief Кодувальник подій сортування у кільцевий буфер.
+ */
+class SortTrace
+{
+public:
+  /**
+   * @param buffer   Кільцевий буфер для закодованих подій.
+   * @param capacity Розмір буфера у байтах.
+   * @param sink     Куди вивантажувати байти.
+   */
+  SortTrace(uint8_t buffer[], uint16_t capacity, SortTraceSink sink);
+
+  /**
+   * @brief Записує заголовок з початковим станом масиву.
+   *
+   * Значення, що не вмістилися в буфер, дописуються з Drain() у міру
+   * вивантаження; доти HasRoom() повертає false. Масив не можна змінювати,
+   * поки заголовок не записано.
+   */
+  void Begin(const int arr[], int size);
+
+  void Compare(uint16_t i, uint16_t j);   ///< Подія порівняння arr[i] і arr[j]
+  void Swap(uint16_t i, uint16_t j);      ///< Подія обміну arr[i] і arr[j]
+  void Set(uint32_t i, int value);        ///< Подія запису value в arr[i]
+  void End();                             ///< Кінець запису
+
+  /**
+   * @brief Чи вміститься bytes байтів подій без очікування приймача.
+   *
+   * false також поки не дописано заголовок. Подія, записана без місця,
+   * відкидається й рахується в Lost().
+   */
+  bool HasRoom(uint16_t bytes) const;
+
+  /**
+   * @brief Передає у приймач стільки байтів, скільки він прийме без очікування.
+   *
+   * @return true, якщо буфер повністю вивантажено (разом із заголовком).
+   */
+  bool Drain();
+
+  uint32_t Events() const { return _events; } ///< Кількість записаних подій
+  uint32_t Bytes() const { return _bytes; }   ///< Кількість записаних байтів
+  uint32_t Lost() const { return _lost; }     ///< Байтів, відкинутих через повний буфер
+
+private:
+  void Event(uint8_t tag, uint16_t i, uint16_t j);
+  void PutVarint(uint32_t value);
+  void PutZigzag(int32_t value);
+  void Put(uint8_t b);
+  bool SendOnce();
+  void FillHeader();
+  uint16_t Room() const { return _capacity - _used; }
+
+  uint8_t *_buffer;
+  uint16_t _capacity;
+  uint16_t _head;   ///< Куди пишеться наступний байт
+  uint16_t _tail;   ///< Звідки вивантажується наступний байт
+  uint16_t _used;   ///< Кількість невивантажених байтів
+  SortTraceSink _sink;
+  const int *_header;   ///< Наступне значення заголовка, що ще не в буфері
+  int _headerLeft;      ///< Скільки значень заголовка залишилося
+  bool _endPending;     ///< End() викликано, поки заголовок не дописано
+  uint32_t _events;
+  uint32_t _bytes;
+  uint32_t _lost;
+};
+
+#endif  // SORTTRACE_H
@@ -0,0 +1,104 @@
+/**
+ * @file SortedWindow.h
+ * @brief Ковзне вікно вибірок, яке підтримується у відсортованому стані «на льоту».
+ *
+ * Замість того щоб щоразу заповнювати масив і сортувати його повністю,
+ * SortedWindow зберігає останні N вибірок у двох масивах:
+ * - кільцевий буфер у порядку надходження (щоб знати, яку вибірку витіснити);
+ * - відсортований масив тих самих значень.
+ *
+ * Кожна нова вибірка вставляється у відсортований масив за допомогою
+ * двійкового пошуку (O(log n) порівнянь), а найстаріша — витісняється.
+ * Медіана та будь-який перцентиль після цього читаються за O(1).
+ *
+ * Особливості:
+ * - Жодної динамічної пам’яті: буфери надає викликаюча сторона.
+ * - Витіснення й вставка виконуються одним зсувом, довжина якого дорівнює
+ *   відстані між старим і новим значенням у відсортованому масиві —
+ *   для повільно змінного сигналу (АЦП потенціометра) це кілька елементів.
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef SORTEDWINDOW_H
+#define SORTEDWINDOW_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Ковзне вікно з відсортованою копією для медіани та перцентилів.
+ *
+ * @example
+ *  int ring[5], sorted[5];
+ *  SortedWindow window(ring, sorted, 5);
+ *  window.Push(analogRead(A0));
+ *  int filtered = window.Median();
+ */
+class SortedWindow
+{
+public:
+  /**
+   * @brief Створює вікно поверх буферів, наданих викликаючою стороною.
+   *
+   * @param ring     Буфер для вибірок у порядку надходження (capacity елементів).
+   * @param sorted   Буфер для відсортованої копії (capacity елементів).
+   * @param capacity Розмір вікна (кількість вибірок).
+   */
+  SortedWindow(int ring[], int sorted[], int capacity);
+
+  /**
+   * @brief Очищає вікно (буфери не змінюються, лише лічильники).
+   */
+  void Reset();
+
+  /**
+   * @brief Додає нову вибірку; якщо вікно заповнене — витісняє найстарішу.
+   *
+   * @param sample Нове значення.
+   */
+  void Push(int sample);
+
+  /**
+   * @brief Кількість вибірок, що зараз знаходяться у вікні.
+   */
+  int Count() const { return _count; }
+
+  /**
+   * @brief Чи заповнене вікно повністю.
+   */
+  bool IsFull() const { return _count == _capacity; }
+
+  /**
+   * @brief Повертає медіану вибірок у вікні.
+   *
+   * Для парної кількості — середнє двох центральних значень.
+   * Для порожнього вікна повертає 0.
+   */
+  int Median() const;
+
+  /**
+   * @brief Повертає перцентиль вибірок у вікні (метод найближчого рангу).
+   *
+   * @param percent Перцентиль 0–100 (0 — мінімум, 100 — максимум).
+   * @return Значення перцентиля або 0 для порожнього вікна.
+   */
+  int Percentile(uint8_t percent) const;
+
+  /**
+   * @brief Відсортований вміст вікна (Count() елементів, за зростанням).
+   */
+  const int *Sorted() const { return _sorted; }
+
+private:
+  int LowerBound(int value) const;
+  int UpperBound(int value) const;
+
+  int *_ring;      ///< Вибірки у порядку надходження
+  int *_sorted;    ///< Ті самі вибірки, відсортовані за зростанням
+  int _capacity;   ///< Розмір вікна
+  int _count;      ///< Поточна кількість вибірок
+  int _head;       ///< Індекс найстарішої вибірки у _ring
+};
+
+#endif  // SORTEDWINDOW_H
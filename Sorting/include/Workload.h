@@ -0,0 +1,86 @@
+/**
+ * @file Workload.h
+ * @brief Швидкий відтворюваний генератор випадкових чисел і тестових наборів для сортування.
+ *
+ * random() з AVR libc повільний (32-бітне ділення), а засівання від
+ * analogRead(A0) робить кожен запуск неповторним. Тут використовується
+ * xorshift32 з явним зерном і зведенням до діапазону множенням зі зсувом
+ * (метод Лемайра) — без ділення у звичайному випадку і без зміщення
+ * розподілу. Усі обчислення цілочисельні й мають фіксовану розрядність,
+ * тому на Arduino і на комп’ютері один і той самий seed дає ідентичні масиви.
+ *
+ * Доступні набори даних (WorkloadKind):
+ * - рівномірний, відсортований, обернений;
+ * - k-відсортований (кожен елемент не далі ніж на k позицій від свого місця);
+ * - з великою кількістю повторів (лише param різних значень);
+ * - розподіл Ципфа (значення-ранг k трапляється пропорційно 1/k).
+ *
+ * Значення мають лежати в межах int16_t (розмір int на AVR).
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdint.h>
+
+/**
+ * @brief Генератор псевдовипадкових чисел xorshift32 (Марсалья).
+ */
+class Xorshift32
+{
+public:
+  /**
+   * @param seed Зерно; 0 замінюється фіксованою ненульовою константою,
+   *             бо з нульового стану xorshift не виходить.
+   */
+  explicit Xorshift32(uint32_t seed);
+
+  uint32_t Next();                 ///< Наступне 32-бітне число
+  uint16_t Below(uint16_t range);  ///< Рівномірне число у [0, range), range > 0
+  int Range(int minValue, int maxValue); ///< Рівномірне число у [minValue, maxValue]
+
+private:
+  uint32_t _state;
+};
+
+/**
+ * @brief Вид тестового набору даних.
+ */
+enum WorkloadKind
+{
+  WORKLOAD_UNIFORM,     ///< Рівномірно випадкові значення
+  WORKLOAD_SORTED,      ///< Уже відсортований за зростанням
+  WORKLOAD_REVERSED,    ///< Відсортований за спаданням
+  WORKLOAD_K_SORTED,    ///< Майже відсортований: зсув кожного елемента ≤ param
+  WORKLOAD_FEW_UNIQUE,  ///< Лише param різних значень (багато повторів)
+  WORKLOAD_ZIPF         ///< Ципф: param рангів, ранг k з імовірністю ~1/k
+};
+
+/**
+ * @brief Заповнює масив тестовими даними заданого виду.
+ *
+ * @param arr      Масив для заповнення.
+ * @param size     Кількість елементів.
+ * @param kind     Вид набору даних.
+ * @param minValue Мінімальне значення (включно).
+ * @param maxValue Максимальне значення (включно); якщо воно менше за
+ *                 minValue, межі міняються місцями.
+ * @param seed     Зерно генератора — однаковий seed дає однаковий масив.
+ * @param param    k для WORKLOAD_K_SORTED, кількість різних значень
+ *                 для WORKLOAD_FEW_UNIQUE, кількість рангів для WORKLOAD_ZIPF
+ *                 (не більше ZIPF_MAX_RANKS); для інших видів ігнорується.
+ */
+void GenerateWorkload(int arr[], int size, WorkloadKind kind,
+                      int minValue, int maxValue, uint32_t seed, uint16_t param);
+
+/**
+ * @brief Найбільша кількість рангів для WORKLOAD_ZIPF.
+ *
+ * Сума ваг ZIPF_SCALE/k для 1000 рангів ще вміщується у 16 біт.
+ */
+const uint16_t ZIPF_MAX_RANKS = 1000;
+
+#endif  // WORKLOAD_H
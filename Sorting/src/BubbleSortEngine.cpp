@@ -0,0 +1,104 @@
+/**
+ * @file BubbleSortEngine.cpp
+ * @brief Реалізація покрокового сортування методом «Бульбашки».
+ *
+ * Алгоритм той самий, що й у BubbleSort_Mon(): прохід за проходом порівнюються
+ * сусідні пари, і якщо за прохід не відбулося жодного обміну — сортування
+ * завершується достроково. Різниця лише в тому, що вкладені цикли розгорнуто
+ * у стан (_pass, _j, _swapped), який зберігається між викликами Step().
+ */
+
+#include "BubbleSortEngine.h"
+
+BubbleSortEngine::BubbleSortEngine()
+  : _arr(NULL), _size(0), _pass(0), _j(0), _swapped(false), _done(true),
+    _compares(0), _swaps(0), _trace(NULL), _less(NULL)
+{
+}
+
+void BubbleSortEngine::Begin(int arr[], int size)
+{
+  _arr = arr;
+  _size = size;
+  _pass = 0;
+  _j = 0;
+  _swapped = false;
+  _compares = 0;
+  _swaps = 0;
+
+  if (_trace != NULL) _trace->Begin(arr, size);
+
+  // Масив з 0 або 1 елемента вже відсортований
+  _done = (arr == NULL || size < 2);
+  if (_done && _trace != NULL) _trace->End();
+}
+
+bool BubbleSortEngine::Step()
+{
+  if (_done) return false;
+  if (TraceBlocked()) return true;  // Кроку не буде, доки loop() не вивантажить запис
+
+  // ===== Тіло внутрішнього циклу =====
+  _compares++;
+  if (_trace != NULL) _trace->Compare(_j, _j + 1);
+
+  // Пара не впорядкована, якщо правий елемент має стояти перед лівим
+  bool outOfOrder = (_less != NULL) ? _less(_arr[_j + 1], _arr[_j])
+                                    : (_arr[_j] > _arr[_j + 1]);
+  if (outOfOrder)
+  {
+    int temp = _arr[_j];
+    _arr[_j] = _arr[_j + 1];
+    _arr[_j + 1] = temp;
+
+    _swapped = true;
+    _swaps++;
+    if (_trace != NULL) _trace->Swap(_j, _j + 1);
+  }
+  _j++;
+
+  // ===== Кінець проходу =====
+  if (_j >= _size - _pass - 1)
+  {
+    // Без обмінів — масив уже впорядкований; інакше — наступний прохід
+    if (!_swapped || _pass >= _size - 2)
+    {
+      _done = true;
+      if (_trace != NULL) _trace->End();
+      return false;
+    }
+
+    _pass++;
+    _j = 0;
+    _swapped = false;
+  }
+
+  return true;
+}
+
+bool BubbleSortEngine::RunSteps(unsigned int maxSteps)
+{
+  while (maxSteps-- > 0 && !TraceBlocked() && Step())
+  {
+  }
+  return !_done;
+}
+
+bool BubbleSortEngine::RunFor(unsigned long budgetUs)
+{
+  unsigned long start = micros();
+
+  while (!_done)
+  {
+    // micros() відносно дорогий на AVR, тому перевіряємо його не на кожному кроці
+    for (unsigned int k = 0; k < STEPS_PER_CHECK; k++)
+    {
+      if (TraceBlocked()) return !_done;  // Чекати на порт тут не можна
+      if (!Step()) break;
+    }
+
+    if (micros() - start >= budgetUs) break;
+  }
+
+  return !_done;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file SortTrace.cpp
+ * @brief Реалізація двійкового запису подій сортування.
+ */
+
+#include "SortTrace.h"
+
+SortTrace::SortTrace(uint8_t buffer[], uint16_t capacity, SortTraceSink sink)
+  : _buffer(buffer), _capacity(capacity), _head(0), _tail(0), _used(0),
+    _sink(sink), _header(NULL), _headerLeft(0), _endPending(false),
+    _events(0), _bytes(0), _lost(0)
+{
+}
+
+void SortTrace::Begin(const int arr[], int size)
+{
+  _events = 0;
+  _bytes = 0;
+  _lost = 0;
+  _endPending = false;
+
+  Put('S');
+  Put('T');
+  Put('R');
+  Put('1');
+  PutVarint((uint32_t)size);
+
+  _header = arr;
+  _headerLeft = size;
+  FillHeader();
+}
+
+void SortTrace::Compare(uint16_t i, uint16_t j)
+{
+  Event(TRACE_TAG_COMPARE, i, j);
+}
+
+void SortTrace::Swap(uint16_t i, uint16_t j)
+{
+  Event(TRACE_TAG_SWAP, i, j);
+}
+
+void SortTrace::Set(uint32_t i, int value)
+{
+  _events++;
+  Put(TRACE_TAG_SET);
+  PutVarint(i);
+  PutZigzag(value);
+}
+
+void SortTrace::End()
+{
+  // Кінець не може обігнати значення заголовка, що ще чекають на місце
+  if (_headerLeft > 0)
+  {
+    _endPending = true;
+    return;
+  }
+  Put(TRACE_TAG_END);
+}
+
+bool SortTrace::HasRoom(uint16_t bytes) const
+{
+  return _headerLeft == 0 && !_endPending && Room() >= bytes;
+}
+
+void SortTrace::Event(uint8_t tag, uint16_t i, uint16_t j)
+{
+  _events++;
+
+  if (j == i + 1)
+  {
+    Put(tag | TRACE_TAG_NEXT);
+    PutVarint(i);
+    return;
+  }
+
+  Put(tag);
+  PutVarint(i);
+  PutVarint(j);
+}
+
+void SortTrace::PutVarint(uint32_t value)
+{
+  // По 7 біт на байт, старший біт — «далі ще є байти»
+  while (value >= 0x80)
+  {
+    Put((uint8_t)(value | 0x80));
+    value >>= 7;
+  }
+  Put((uint8_t)value);
+}
+
+void SortTrace::PutZigzag(int32_t value)
+{
+  // Zigzag: невеликі від’ємні числа теж кодуються коротко
+  PutVarint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+void SortTrace::Put(uint8_t b)
+{
+  // Буфер заповнено — одна спроба вивантаження без очікування. Якщо
+  // приймач зайнятий, байт втрачено: той, хто пише події, мав перевірити
+  // HasRoom(), а Lost() показує, що запис уже не відтворити.
+  if (_used == _capacity && !SendOnce())
+  {
+    _lost++;
+    return;
+  }
+
+  _buffer[_head] = b;
+  _head = (_head + 1) % _capacity;
+  _used++;
+  _bytes++;
+}
+
+/**
+ * @brief Одна передача суцільного шматка буфера у приймач.
+ *
+ * @return true, якщо приймач узяв хоча б один байт.
+ */
+bool SortTrace::SendOnce()
+{
+  if (_used == 0) return false;
+
+  // Суцільний шматок від _tail до кінця буфера або до _head
+  uint16_t chunk = (_tail + _used <= _capacity) ? _used : (uint16_t)(_capacity - _tail);
+  size_t sent = _sink(_buffer + _tail, chunk);
+  if (sent == 0) return false;
+
+  _tail = (_tail + sent) % _capacity;
+  _used -= sent;
+  return true;
+}
+
+/**
+ * @brief Дописує значення заголовка (і відкладений кінець), поки є місце.
+ */
+void SortTrace::FillHeader()
+{
+  while (_headerLeft > 0)
+  {
+    if (Room() < TRACE_MAX_VALUE_BYTES)
+    {
+      if (!SendOnce()) return;
+      continue;
+    }
+    PutZigzag(*_header++);
+    _headerLeft--;
+  }
+
+  if (_endPending)
+  {
+    if (Room() == 0 && !SendOnce()) return;
+    _endPending = false;
+    Put(TRACE_TAG_END);
+  }
+}
+
+bool SortTrace::Drain()
+{
+  for (;;)
+  {
+    FillHeader();
+    if (_used == 0) return _headerLeft == 0 && !_endPending;
+    if (!SendOnce()) return false;
+  }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file SortedWindow.cpp
+ * @brief Реалізація ковзного відсортованого вікна з потоковою медіаною.
+ */
+
+#include "SortedWindow.h"
+
+SortedWindow::SortedWindow(int ring[], int sorted[], int capacity)
+  : _ring(ring), _sorted(sorted), _capacity(capacity), _count(0), _head(0)
+{
+}
+
+void SortedWindow::Reset()
+{
+  _count = 0;
+  _head = 0;
+}
+
+/**
+ * @brief Перший індекс у відсортованому масиві, значення за яким >= value.
+ */
+int SortedWindow::LowerBound(int value) const
+{
+  int lo = 0;
+  int hi = _count;
+  while (lo < hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+    if (_sorted[mid] < value) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+/**
+ * @brief Перший індекс у відсортованому масиві, значення за яким > value.
+ */
+int SortedWindow::UpperBound(int value) const
+{
+  int lo = 0;
+  int hi = _count;
+  while (lo < hi)
+  {
+    int mid = lo + (hi - lo) / 2;
+    if (_sorted[mid] <= value) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+/**
+ * @brief Додає вибірку до вікна.
+ *
+ * Поки вікно не заповнене — звичайна вставка з двійковим пошуком позиції.
+ * Після заповнення найстаріша вибірка витісняється, і замість того щоб
+ * видаляти її та вставляти нову окремо (два зсуви), елементи між старою
+ * та новою позиціями зсуваються на одну комірку в потрібний бік.
+ */
+void SortedWindow::Push(int sample)
+{
+  if (_capacity <= 0) return;
+
+  if (_count < _capacity)
+  {
+    int pos = UpperBound(sample);
+    for (int k = _count; k > pos; k--) _sorted[k] = _sorted[k - 1];
+    _sorted[pos] = sample;
+
+    _ring[(_head + _count) % _capacity] = sample;
+    _count++;
+    return;
+  }
+
+  // Вікно заповнене — замінюємо найстарішу вибірку на нову
+  int oldest = _ring[_head];
+  _ring[_head] = sample;
+  _head = (_head + 1) % _capacity;
+
+  int oldPos = LowerBound(oldest); // Будь-яке з рівних значень підходить
+
+  if (sample >= oldest)
+  {
+    // Нове значення більше — зсуваємо проміжок ліворуч
+    int newPos = UpperBound(sample) - 1;
+    for (int k = oldPos; k < newPos; k++) _sorted[k] = _sorted[k + 1];
+    _sorted[newPos] = sample;
+  }
+  else
+  {
+    // Нове значення менше — зсуваємо проміжок праворуч
+    int newPos = LowerBound(sample);
+    for (int k = oldPos; k > newPos; k--) _sorted[k] = _sorted[k - 1];
+    _sorted[newPos] = sample;
+  }
+}
+
+int SortedWindow::Median() const
+{
+  if (_count == 0) return 0;
+
+  int mid = (_count - 1) / 2;
+  if (_count % 2 != 0) return _sorted[mid];
+
+  // Середнє двох центральних значень без переповнення int
+  long sum = (long)_sorted[mid] + (long)_sorted[mid + 1];
+  return (int)(sum / 2);
+}
+
+int SortedWindow::Percentile(uint8_t percent) const
+{
+  if (_count == 0) return 0;
+  if (percent > 100) percent = 100;
+
+  // Найближчий ранг з округленням: 0% → перший, 100% → останній
+  long rank = ((long)percent * (_count - 1) + 50) / 100;
+  return _sorted[rank];
+}
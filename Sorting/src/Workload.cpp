@@ -0,0 +1,162 @@
+/**
+ * @file Workload.cpp
+ * @brief Реалізація генератора xorshift32 і тестових наборів даних.
+ */
+
+#include "Workload.h"
+
+/**
+ * @brief Масштаб ваг розподілу Ципфа: вага рангу k дорівнює ZIPF_SCALE / k.
+ */
+static const uint16_t ZIPF_SCALE = 8192;
+
+Xorshift32::Xorshift32(uint32_t seed)
+  : _state(seed != 0 ? seed : 0x9E3779B9UL)
+{
+}
+
+uint32_t Xorshift32::Next()
+{
+  uint32_t x = _state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  _state = x;
+  return x;
+}
+
+/**
+ * @brief Рівномірне число у [0, range) множенням зі зсувом (метод Лемайра).
+ *
+ * Старші 16 біт випадкового числа множаться на range; старша половина
+ * добутку — результат. Молодша половина показує, чи не потрапили ми
+ * у «зайвий» залишок, що спричинив би зміщення; лише тоді (рідко)
+ * обчислюється залишок від ділення і число генерується повторно.
+ * 16-бітна версія обрана, бо 32×32→64 множення на AVR дуже дороге.
+ */
+uint16_t Xorshift32::Below(uint16_t range)
+{
+  if (range == 0) return 0;
+
+  uint32_t m = (uint32_t)(uint16_t)(Next() >> 16) * range;
+  uint16_t low = (uint16_t)m;
+
+  if (low < range)
+  {
+    uint16_t threshold = (uint16_t)(0x10000UL - range) % range;
+    while (low < threshold)
+    {
+      m = (uint32_t)(uint16_t)(Next() >> 16) * range;
+      low = (uint16_t)m;
+    }
+  }
+
+  return (uint16_t)(m >> 16);
+}
+
+int Xorshift32::Range(int minValue, int maxValue)
+{
+  uint16_t span = (uint16_t)((long)maxValue - minValue + 1);
+
+  // span == 0 означає повний 16-бітний діапазон
+  if (span == 0) return (int)(int16_t)(Next() >> 16);
+  return (int)((long)minValue + Below(span));
+}
+
+/**
+ * @brief Рівномірно розподілене значення між minValue і maxValue для позиції i з size.
+ */
+static int Ramp(int i, int size, int minValue, int maxValue)
+{
+  if (size < 2) return minValue;
+  return (int)((long)minValue + ((long)maxValue - minValue) * i / (size - 1));
+}
+
+void GenerateWorkload(int arr[], int size, WorkloadKind kind,
+                      int minValue, int maxValue, uint32_t seed, uint16_t param)
+{
+  Xorshift32 rng(seed);
+
+  if (maxValue < minValue)
+  {
+    int temp = minValue;
+    minValue = maxValue;
+    maxValue = temp;
+  }
+
+  switch (kind)
+  {
+    case WORKLOAD_UNIFORM:
+      for (int i = 0; i < size; i++) arr[i] = rng.Range(minValue, maxValue);
+      break;
+
+    case WORKLOAD_SORTED:
+      for (int i = 0; i < size; i++) arr[i] = Ramp(i, size, minValue, maxValue);
+      break;
+
+    case WORKLOAD_REVERSED:
+      for (int i = 0; i < size; i++) arr[i] = Ramp(size - 1 - i, size, minValue, maxValue);
+      break;
+
+    case WORKLOAD_K_SORTED:
+    {
+      // Відсортований масив, перемішаний усередині блоків по k+1 елементів:
+      // жоден елемент не віддаляється від свого місця більш ніж на k позицій.
+      // Блок у межах [1, size]: param + 1 не переповнюється, а start
+      // просувається на len і ніколи не виходить за size
+      long block = (long)param + 1;
+      if (block > size) block = size;
+      if (block < 1) block = 1;
+      for (int i = 0; i < size; i++) arr[i] = Ramp(i, size, minValue, maxValue);
+
+      for (int start = 0; start < size;)
+      {
+        int len = (size - start < block) ? size - start : (int)block;
+        for (int i = len - 1; i > 0; i--) // Фішер–Єйтс
+        {
+          int j = rng.Below((uint16_t)(i + 1));
+          int temp = arr[start + i];
+          arr[start + i] = arr[start + j];
+          arr[start + j] = temp;
+        }
+        start += len;
+      }
+      break;
+    }
+
+    case WORKLOAD_FEW_UNIQUE:
+    {
+      uint16_t distinct = (param > 0) ? param : 1;
+      for (int i = 0; i < size; i++)
+      {
+        arr[i] = Ramp(rng.Below(distinct), distinct, minValue, maxValue);
+      }
+      break;
+    }
+
+    case WORKLOAD_ZIPF:
+    {
+      // Ранги 1..m з вагами ZIPF_SCALE / k; ранг k → значення minValue + k - 1
+      long span = (long)maxValue - minValue + 1;
+      uint16_t ranks = (param > 0) ? param : 1;
+      if (ranks > ZIPF_MAX_RANKS) ranks = ZIPF_MAX_RANKS;
+      if (ranks > span) ranks = (uint16_t)span;
+
+      uint16_t total = 0;
+      for (uint16_t k = 1; k <= ranks; k++) total += ZIPF_SCALE / k;
+
+      for (int i = 0; i < size; i++)
+      {
+        uint16_t u = rng.Below(total);
+        uint16_t k = 1;
+        while (u >= ZIPF_SCALE / k)
+        {
+          u -= ZIPF_SCALE / k;
+          k++;
+        }
+        arr[i] = minValue + (k - 1);
+      }
+      break;
+    }
+  }
+}
@@ -0,0 +1,288 @@
+/**
+ * @file ParallelSort.cpp
+ * @brief Реалізація паралельного сортування злиттям на пулі потоків з перехопленням задач.
+ *
+ * Пул: у кожного потоку своя черга задач. Нові задачі кладуться в кінець
+ * власної черги і звідти ж беруться (LIFO — дані ще «теплі» в кеші),
+ * а вільний потік краде задачі з початку чужих черг (там найбільші
+ * шматки роботи). Потік, що чекає на завершення групи задач, не спить,
+ * а виконує задачі сам — тому рекурсивне розгалуження не блокує пул.
+ */
+
+#include "ParallelSort.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Розмір шматка, який сортується послідовно (std::sort).
+ */
+const size_t SORT_CUTOFF = 8192;
+
+/**
+ * @brief Розмір злиття, яке виконується послідовно (std::merge).
+ */
+const size_t MERGE_CUTOFF = 8192;
+
+thread_local unsigned tlsWorker = 0; ///< Номер черги поточного потоку
+
+/**
+ * @brief Пул потоків з окремою чергою на кожен потік і крадіжкою задач.
+ *
+ * Потік, що викликав сортування, є робочим потоком №0.
+ */
+class WorkStealingPool
+{
+public:
+  explicit WorkStealingPool(unsigned threads)
+    : _stop(false)
+  {
+    for (unsigned i = 0; i < threads; i++) _queues.emplace_back(new Queue());
+
+    tlsWorker = 0;
+    for (unsigned i = 1; i < threads; i++)
+    {
+      _workers.emplace_back([this, i] {
+        tlsWorker = i;
+        while (!_stop.load(std::memory_order_relaxed))
+        {
+          if (!RunOne()) std::this_thread::yield();
+        }
+      });
+    }
+  }
+
+  ~WorkStealingPool()
+  {
+    _stop = true;
+    for (auto &w : _workers) w.join();
+  }
+
+  void Spawn(std::function<void()> task)
+  {
+    Queue &q = *_queues[tlsWorker];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    q.tasks.push_back(std::move(task));
+  }
+
+  /**
+   * @brief Виконує одну задачу: власну (з кінця) або вкрадену (з початку чужої черги).
+   *
+   * @return true, якщо задачу знайдено й виконано.
+   */
+  bool RunOne()
+  {
+    std::function<void()> task;
+    unsigned self = tlsWorker;
+    unsigned count = (unsigned)_queues.size();
+
+    {
+      Queue &q = *_queues[self];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (!q.tasks.empty())
+      {
+        task = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      }
+    }
+
+    for (unsigned k = 1; !task && k < count; k++)
+    {
+      Queue &q = *_queues[(self + k) % count];
+      std::lock_guard<std::mutex> lock(q.mutex);
+      if (!q.tasks.empty())
+      {
+        task = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+    }
+
+    if (!task) return false;
+    task();
+    return true;
+  }
+
+private:
+  struct Queue
+  {
+    std::mutex mutex;
+    std::deque<std::function<void()> > tasks;
+  };
+
+  std::vector<std::unique_ptr<Queue> > _queues;
+  std::vector<std::thread> _workers;
+  std::atomic<bool> _stop;
+};
+
+/**
+ * @brief Група задач «розгалуження–об’єднання».
+ */
+class TaskGroup
+{
+public:
+  explicit TaskGroup(WorkStealingPool &pool) : _pool(pool), _pending(0) {}
+
+  void Spawn(std::function<void()> task)
+  {
+    _pending++;
+    _pool.Spawn([this, task] {
+      task();
+      _pending--;
+    });
+  }
+
+  /**
+   * @brief Чекає завершення всіх задач групи, виконуючи тим часом будь-які задачі пулу.
+   */
+  void Wait()
+  {
+    while (_pending.load() > 0)
+    {
+      if (!_pool.RunOne()) std::this_thread::yield();
+    }
+  }
+
+private:
+  WorkStealingPool &_pool;
+  std::atomic<int> _pending;
+};
+
+/**
+ * @brief Спільний стан одного виклику ParallelSort().
+ */
+template <typename Less>
+struct SortContext
+{
+  WorkStealingPool *pool;
+  Less less;
+  int *data;          ///< Основний масив (зміни в ньому записуються у trace)
+  size_t size;
+  SortTrace *trace;
+  std::mutex traceMutex;
+
+  /**
+   * @brief Записує події TRACE_TAG_SET для шматка, що опинився в основному масиві.
+   */
+  void Emit(const int *out, size_t n)
+  {
+    if (trace == NULL || out < data || out >= data + size) return;
+
+    std::lock_guard<std::mutex> lock(traceMutex);
+    size_t base = (size_t)(out - data);
+    for (size_t k = 0; k < n; k++) trace->Set((uint32_t)(base + k), out[k]);
+  }
+};
+
+/**
+ * @brief Зливає x[0..nx) і y[0..ny) в out, розбиваючи велике злиття на незалежні частини.
+ */
+template <typename Less>
+void Merge(SortContext<Less> &ctx, const int *x, size_t nx, const int *y, size_t ny, int *out)
+{
+  if (nx + ny <= MERGE_CUTOFF)
+  {
+    std::merge(x, x + nx, y, y + ny, out, ctx.less);
+    ctx.Emit(out, nx + ny);
+    return;
+  }
+
+  // Ділимо більшу послідовність навпіл, у меншій шукаємо точку розрізу
+  if (nx < ny)
+  {
+    std::swap(x, y);
+    std::swap(nx, ny);
+  }
+
+  size_t mx = nx / 2;
+  size_t my = (size_t)(std::lower_bound(y, y + ny, x[mx], ctx.less) - y);
+
+  TaskGroup group(*ctx.pool);
+  group.Spawn([&ctx, x, mx, y, my, out] { Merge(ctx, x, mx, y, my, out); });
+  Merge(ctx, x + mx, nx - mx, y + my, ny - my, out + mx + my);
+  group.Wait();
+}
+
+/**
+ * @brief Сортує a[0..n); результат опиняється в b, якщо toBuffer, інакше в a.
+ *
+ * Буфери чергуються між рівнями рекурсії («пінг-понг»), тож кожен рівень
+ * виконує лише одне злиття без додаткового копіювання.
+ */
+template <typename Less>
+void Sort(SortContext<Less> &ctx, int *a, int *b, size_t n, bool toBuffer)
+{
+  if (n <= SORT_CUTOFF)
+  {
+    std::sort(a, a + n, ctx.less);
+    ctx.Emit(a, n);
+    if (toBuffer) std::copy(a, a + n, b);
+    return;
+  }
+
+  size_t half = n / 2;
+
+  // Половини мають опинитися там, звідки читатиме злиття цього рівня
+  TaskGroup group(*ctx.pool);
+  group.Spawn([&ctx, a, b, half, toBuffer] { Sort(ctx, a, b, half, !toBuffer); });
+  Sort(ctx, a + half, b + half, n - half, !toBuffer);
+  group.Wait();
+
+  const int *src = toBuffer ? a : b;
+  int *dst = toBuffer ? b : a;
+  Merge(ctx, src, half, src + half, n - half, dst);
+}
+
+/**
+ * @brief Адаптер SortLess для стандартних алгоритмів.
+ */
+struct FunctionLess
+{
+  SortLess fn;
+  bool operator()(int a, int b) const { return fn(a, b); }
+};
+
+template <typename Less>
+void Run(int data[], size_t size, unsigned threads, Less less, SortTrace *trace)
+{
+  WorkStealingPool pool(threads);
+  std::vector<int> buffer(size);
+
+  SortContext<Less> ctx;
+  ctx.pool = &pool;
+  ctx.less = less;
+  ctx.data = data;
+  ctx.size = size;
+  ctx.trace = trace;
+
+  if (trace != NULL) trace->Begin(data, (int)size);
+  Sort(ctx, data, buffer.data(), size, false);
+  if (trace != NULL) trace->End();
+}
+
+} // namespace
+
+void ParallelSort(int data[], size_t size, unsigned threads, SortLess less, SortTrace *trace)
+{
+  if (threads == 0) threads = std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+
+  // Без функції порівняння — вбудоване порівняння, яке компілятор може вбудувати
+  if (less == NULL)
+  {
+    Run(data, size, threads, std::less<int>(), trace);
+  }
+  else
+  {
+    FunctionLess fl = { less };
+    Run(data, size, threads, fl, trace);
+  }
+}
@@ -0,0 +1,90 @@
+/**
+ * @file parallel_bench.cpp
+ * @brief Вимірювання масштабування ParallelSort від 1 до N потоків (збірка native).
+ *
+ * Масив генерується тим самим GenerateWorkload(), що й на Arduino, тож
+ * однакове зерно дає однакові дані. Для кожної кількості потоків
+ * вимірюється час сортування, прискорення та ефективність, а результат
+ * порівнюється з послідовним еталоном (std::sort).
+ *
+ * Запуск:
+ *   pio run -e native && .pio/build/native/program [розмір] [потоків] [вид] [зерно]
+ *
+ * @author Дмитро Агеєв
+ * @date 18.10.2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "ParallelSort.h"
+#include "Workload.h"
+
+/**
+ * @brief Кількість повторів кожного вимірювання (береться найкращий час).
+ */
+const int REPEATS = 3;
+
+static double SortMs(const std::vector<int> &input, std::vector<int> &output, unsigned threads)
+{
+  double best = 1e300;
+  for (int r = 0; r < REPEATS; r++)
+  {
+    output = input;
+    auto start = std::chrono::steady_clock::now();
+    ParallelSort(output.data(), output.size(), threads);
+    auto stop = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+  }
+  return best;
+}
+
+int main(int argc, char **argv)
+{
+  size_t size = (argc > 1) ? (size_t)atol(argv[1]) : 4000000;
+  unsigned maxThreads = (argc > 2) ? (unsigned)atoi(argv[2]) : std::thread::hardware_concurrency();
+  WorkloadKind kind = (argc > 3) ? (WorkloadKind)atoi(argv[3]) : WORKLOAD_UNIFORM;
+  uint32_t seed = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 10) : 20251005UL;
+  if (maxThreads == 0) maxThreads = 1;
+
+  std::vector<int> input(size);
+  GenerateWorkload(input.data(), (int)size, kind, -30000, 30000, seed, 100);
+
+  // Послідовний еталон
+  std::vector<int> reference = input;
+  auto start = std::chrono::steady_clock::now();
+  std::sort(reference.begin(), reference.end());
+  double referenceMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  printf("Елементів: %zu, вид даних: %d, зерно: %u\n", size, (int)kind, seed);
+  printf("std::sort (еталон): %.1f мс\n\n", referenceMs);
+  printf("потоків\tчас, мс\tприскорення\tефективність\tрезультат\n");
+
+  std::vector<int> output;
+  double baseMs = 0;
+  bool allOk = true;
+
+  // 1, 2, 4, ... та точна кількість ядер, навіть якщо вона не степінь двійки
+  std::vector<unsigned> counts;
+  for (unsigned t = 1; t < maxThreads; t *= 2) counts.push_back(t);
+  counts.push_back(maxThreads);
+
+  for (unsigned threads : counts)
+  {
+    double ms = SortMs(input, output, threads);
+    if (threads == 1) baseMs = ms;
+
+    bool ok = (output == reference);
+    allOk = allOk && ok;
+
+    printf("%u\t%.1f\t%.2f\t\t%.0f%%\t\t%s\n", threads, ms, baseMs / ms,
+           100.0 * baseMs / ms / threads, ok ? "OK" : "ПОМИЛКА");
+  }
+
+  return allOk ? 0 : 1;
+}
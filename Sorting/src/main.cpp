@@ -16,9 +16,14 @@
  *
  * Функції:
  * - FillArray: заповнює масив випадковими цілими числами.
- * - WaitAnyKey: очікує натискання будь-якої клавіші через серійний монітор.
+ * - ShowPrompt / KeyPressed: підказка та неблокуюча перевірка натискання клавіші.
  * - PrintArray: виводить вміст масиву у серійний монітор.
  * - BubbleSort: сортує масив за зростанням методом «Бульбашки».
+ * - RecordSortDemo: стабільне сортування записів через індекси (ArgSort).
+ *
+ * Клавіша m у будь-який момент виводить звіт про SRAM (lib/MemDiag) замість
+ * переходу до наступного етапу; такий самий звіт друкується після сортування
+ * і після потокової медіани.
  *
  * @author Дмитро Агеєв
  * @date 05.10.2025
@@ -26,6 +31,12 @@
 
 #include <Arduino.h> // Бібліотека Arduino для базових функцій
 #include "BubbleSort_Mon.h"
+#include "SortedWindow.h"
+#include "BubbleSortEngine.h"
+#include "SortTrace.h"
+#include "Workload.h"
+#include "ArgSort.h"
+#include <MemDiag.h>
 
 // Межі випадкових чисел (унікальні назви, щоб уникнути конфлікту)
 /**
@@ -41,15 +52,85 @@ const int RND_MIN = 0;
  */
 const int RND_MAX = 100;
 
+/**
+ * @brief Зерно генератора тестових даних.
+ *
+ * Однакове зерно дає однаковий масив при кожному запуску (і на комп’ютері),
+ * тому результати вимірювань сортування можна порівнювати між собою.
+ */
+const uint32_t WORKLOAD_SEED = 20251005UL;
+
+/**
+ * @brief Вид тестових даних, якими заповнюється масив.
+ *
+ * Для порівняння алгоритмів спробуйте WORKLOAD_REVERSED (найгірший випадок
+ * «Бульбашки»), WORKLOAD_K_SORTED або WORKLOAD_FEW_UNIQUE.
+ */
+const WorkloadKind WORKLOAD_KIND = WORKLOAD_UNIFORM;
+
+/**
+ * @brief Параметр тестових даних (k, кількість різних значень або рангів).
+ */
+const uint16_t WORKLOAD_PARAM = 3;
+
 /**
  * @brief Визначає розмір масиву, що використовується в програмі.
  *
  * Ця константа задає кількість елементів, які буде містити масив.
+ * У режимі запису подій (SORT_TRACE) кожна подія коштує 2–3 байти,
+ * тому масив може бути значно більшим.
  */
+#ifdef SORT_TRACE
+const int MY_ARRAY_SIZE = 100;
+#else
 const int MY_ARRAY_SIZE = 10;
+#endif
+
+/**
+ * @brief Швидкість серійного порту.
+ *
+ * Двійковий запис подій (середовище uno_trace) передається на 115200 бод
+ * і читається скриптом tools/sort_replay.py.
+ */
+#ifdef SORT_TRACE
+const unsigned long SERIAL_BAUD = 115200;
+#else
+const unsigned long SERIAL_BAUD = 9600;
+#endif
 
 int MyArr[MY_ARRAY_SIZE]; // Масив для збереження випадкових чисел
 
+/**
+ * @brief Розмір ковзного вікна для демонстрації потокової медіани.
+ */
+const int WINDOW_SIZE = 5;
+
+/**
+ * @brief Кількість вибірок, що подаються у вікно під час демонстрації.
+ */
+const int STREAM_LENGTH = 20;
+
+int WindowRing[WINDOW_SIZE];   // Вибірки вікна у порядку надходження
+int WindowSorted[WINDOW_SIZE]; // Відсортована копія вибірок вікна
+
+/**
+ * @brief Вимірювання з кількох каналів — запис, який дорого переставляти цілим.
+ */
+struct ChannelSample
+{
+  uint32_t time;     ///< Момент вимірювання, мс
+  uint8_t channel;   ///< Номер каналу
+  int16_t value;     ///< Значення
+};
+
+/**
+ * @brief Кількість записів для демонстрації сортування через індекси.
+ */
+const uint8_t RECORD_COUNT = 16;
+
+ChannelSample Records[RECORD_COUNT]; // Записи у порядку надходження
+uint8_t RecordOrder[RECORD_COUNT];   // Індекси записів (1 байт, бо записів ≤ 256)
+
 // Прототипи функцій
 
 /**
@@ -60,16 +141,6 @@ int MyArr[MY_ARRAY_SIZE]; // Масив для збереження випадк
  */
 void FillArray(int arr[], int size);
 
-/**
- * @brief Очікує натискання будь-якої клавіші через серійний монітор.
- *
- * Використовується для паузи між діями програми, щоб користувач міг
- * переглянути інформацію або підготуватися до наступного кроку.
- * 
- * @param msg Повідомлення, яке буде виведено користувачу перед очікуванням.
- */
-void WaitAnyKey(String msg);
-
 /**
  * @brief Сортує масив за зростанням методом «бульбашки».
  *
@@ -91,82 +162,264 @@ void BubbleSort(int arr[], int size);
  */
 void PrintArray(int arr[], int size, String msg);
 
+/**
+ * @brief Демонструє потокову медіану на ковзному вікні.
+ *
+ * Подає у SortedWindow зашумлений «сигнал» і для кожної нової вибірки
+ * виводить медіану та 90-й перцентиль вікна без повторного сортування.
+ */
+void StreamMedianDemo();
+
+/**
+ * @brief Демонструє сортування записів через масив індексів.
+ *
+ * Записи надходять за часом і впорядковуються за каналом стабільно, тож
+ * у межах каналу зберігається порядок за часом. Сортуються лише
+ * однобайтові індекси, а записи переставляються один раз наприкінці.
+ */
+void RecordSortDemo();
+
+// ===== Покроковий сценарій програми =====
+
+/**
+ * @brief Етапи демонстрації, між якими програма переходить у loop().
+ *
+ * Кожен етап, що очікує користувача, лише перевіряє Serial і одразу
+ * повертає керування, тож loop() ніколи не блокується.
+ */
+enum Stage
+{
+  STAGE_FILL,     ///< Очікування клавіші → заповнення масиву
+  STAGE_PRINT,    ///< Очікування клавіші → вивід несортованого масиву
+  STAGE_SORT,     ///< Очікування клавіші → початок сортування
+  STAGE_SORTING,  ///< Сортування просувається порціями
+  STAGE_STREAM,   ///< Очікування клавіші → потокова медіана
+  STAGE_RECORDS,  ///< Очікування клавіші → сортування записів через індекси
+  STAGE_DONE      ///< Демонстрацію завершено
+};
+
+/**
+ * @brief Бюджет часу на сортування за один прохід loop(), мкс.
+ */
+const unsigned long SORT_SLICE_US = 1000;
+
+Stage stage = STAGE_FILL;          // Поточний етап демонстрації
+BubbleSortEngine sortEngine;       // Відновлюваний автомат сортування
+unsigned long sortStartUs = 0;     // Момент початку сортування
+unsigned long sortMaxSliceUs = 0;  // Найдовша порція сортування
+
+#ifdef SORT_TRACE
+/**
+ * @brief Розмір кільцевого буфера подій (дорівнює буферу передачі Serial).
+ */
+const uint16_t TRACE_BUFFER_SIZE = 64;
+
+uint8_t TraceBuffer[TRACE_BUFFER_SIZE]; // Закодовані події, що ще не передані
+
+/**
+ * @brief Передає у Serial стільки байтів запису, скільки вміщує буфер передачі.
+ */
+size_t TraceToSerial(const uint8_t *data, size_t len)
+{
+  size_t room = Serial.availableForWrite();
+  if (len > room) len = room;
+  return Serial.write(data, len);
+}
+
+SortTrace sortTrace(TraceBuffer, TRACE_BUFFER_SIZE, TraceToSerial); // Запис подій
+#endif
+
+/**
+ * @brief Виводить підказку для наступного етапу.
+ *
+ * @param msg Текст підказки (наприклад, "Натисніть будь-яку клавішу...").
+ */
+void ShowPrompt(String msg);
+
+/**
+ * @brief Перевіряє без очікування, чи натиснув користувач клавішу.
+ *
+ * @return true, якщо у Serial був символ (його буде вилучено з буфера).
+ */
+bool KeyPressed();
+
+/**
+ * @brief Виконує одну порцію сортування та підсумок після його завершення.
+ */
+void ServiceSorting();
+
 // ===== Функції Arduino =====
 
 /**
  * @brief Функція setup() виконується один раз під час старту плати Arduino.
  *
- * Функція виконує такі кроки:
- * 1. Ініціалізує серійний порт на швидкості 9600 бод.
- * 2. Очікує введення користувача для заповнення масиву випадковими числами.
- * 3. Очікує введення користувача для виведення невідсортованого масиву.
- * 4. Очікує введення користувача для сортування масиву методом BubbleSort або BubbleSort_Mon.
- * 5. Виводить відсортований масив.
- *
- * Повідомлення та підказки виводяться українською мовою.
+ * Ініціалізує серійний порт (9600 бод, у режимі запису подій — 115200),
+ * підключає запис подій, якщо його увімкнено, і виводить першу підказку.
+ * Усі подальші етапи виконуються у loop().
  */
 void setup()
 {
   // put your setup code here, to run once:
-    Serial.begin(9600);  // Ініціалізація серійного порту зі швидкістю 9600 бод
+    Serial.begin(SERIAL_BAUD);  // Ініціалізація серійного порту
 
-  // Очікування дії користувача перед заповненням масиву
-  WaitAnyKey("Натисніть будь-яку клавішу, щоб заповнити масив випадковими числами...");
-  FillArray(MyArr, MY_ARRAY_SIZE); 
+#ifdef SORT_TRACE
+  sortEngine.SetTrace(&sortTrace);
+#endif
 
-  // Вивід початкового (несортованого) масиву
-  WaitAnyKey("Натисніть будь-яку клавішу, щоб переглянути вміст масиву...");
-  PrintArray(MyArr, MY_ARRAY_SIZE, "Несортований масив:");
-
-  // Сортування масиву
-  WaitAnyKey("Натисніть будь-яку клавішу, щоб відсортувати масив методом 'Бульбашки'...");
-  /* Поставити "зірочку" -> /
-  BubbleSort(MyArr, MY_ARRAY_SIZE);
-  /*/
-  BubbleSort_Mon(MyArr, MY_ARRAY_SIZE);
-  /**/
-
-  // Вивід відсортованого масиву
-  PrintArray(MyArr, MY_ARRAY_SIZE, "Масив після сортування (за зростанням):");
+  ShowPrompt("Натисніть будь-яку клавішу, щоб заповнити масив випадковими числами...");
 }
 
 
 /**
  * @brief Функція loop() виконується циклічно після setup().
  *
- * У даній програмі не використовується, бо основна логіка виконується лише один раз.
+ * Програма переходить між етапами:
+ * 1. Очікує введення користувача для заповнення масиву випадковими числами.
+ * 2. Очікує введення користувача для виведення невідсортованого масиву.
+ * 3. Очікує введення користувача для сортування масиву.
+ * 4. Сортує масив порціями не довше SORT_SLICE_US за один прохід loop();
+ *    натискання клавіші під час сортування показує поточний прогрес.
+ * 5. Виводить відсортований масив.
+ * 6. Демонструє потокову медіану на ковзному вікні.
+ * 7. Сортує записи з кількох каналів через масив індексів.
+ *
+ * Жоден етап не блокує loop(), тому поряд можна обслуговувати інші задачі.
  */
-void loop() {
-  // Порожня функція
+void loop()
+{
+  switch (stage)
+  {
+    case STAGE_FILL:
+      if (!KeyPressed()) break;
+      FillArray(MyArr, MY_ARRAY_SIZE);
+      ShowPrompt("Натисніть будь-яку клавішу, щоб переглянути вміст масиву...");
+      stage = STAGE_PRINT;
+      break;
+
+    case STAGE_PRINT:
+      if (!KeyPressed()) break;
+      PrintArray(MyArr, MY_ARRAY_SIZE, "Несортований масив:");
+      ShowPrompt("Натисніть будь-яку клавішу, щоб відсортувати масив методом 'Бульбашки'...");
+      stage = STAGE_SORT;
+      break;
+
+    case STAGE_SORT:
+      if (!KeyPressed()) break;
+      /* Поставити "зірочку" -> /
+      BubbleSort_Mon(MyArr, MY_ARRAY_SIZE); // Блокуючий варіант з покроковим виводом
+      /*/
+      Serial.println("Виконується сортування масиву методом 'Бульбашки'...\r\n");
+      /**/
+      sortEngine.Begin(MyArr, MY_ARRAY_SIZE);
+      sortStartUs = micros();
+      sortMaxSliceUs = 0;
+      stage = STAGE_SORTING;
+      break;
+
+    case STAGE_SORTING:
+      ServiceSorting();
+      break;
+
+    case STAGE_STREAM:
+      if (!KeyPressed()) break;
+      StreamMedianDemo();
+      MemDiagReport(Serial, F("після потокової медіани"));
+      ShowPrompt("Натисніть будь-яку клавішу, щоб відсортувати записи каналів через індекси...");
+      stage = STAGE_RECORDS;
+      break;
+
+    case STAGE_RECORDS:
+      if (!KeyPressed()) break;
+      RecordSortDemo();
+      stage = STAGE_DONE;
+      break;
+
+    case STAGE_DONE:
+      break;
+  }
+}
+
+/**
+ * @brief Просуває сортування на одну порцію та обробляє запити прогресу.
+ *
+ * Поки сортування триває, будь-яка клавіша виводить номер проходу та
+ * кількість порівнянь — це показує, що Serial обслуговується паралельно.
+ * У режимі SORT_TRACE замість цього вивантажуються закодовані події.
+ * Після завершення виводиться відсортований масив і статистика.
+ */
+void ServiceSorting()
+{
+#ifdef SORT_TRACE
+  // Текст не можна змішувати з двійковим записом — лише вивантажуємо події
+  sortTrace.Drain();
+#else
+  if (KeyPressed())
+  {
+    Serial.print("  ... прохід №");
+    Serial.print(sortEngine.Pass());
+    Serial.print(", порівнянь: ");
+    Serial.println(sortEngine.Comparisons());
+  }
+#endif
+
+  unsigned long sliceStart = micros();
+  bool pending = sortEngine.RunFor(SORT_SLICE_US);
+  unsigned long slice = micros() - sliceStart;
+  if (slice > sortMaxSliceUs) sortMaxSliceUs = slice;
+
+  if (pending) return;
+
+#ifdef SORT_TRACE
+  // Решта запису має піти у порт раніше за текстові повідомлення;
+  // до того ServiceSorting() лише вивантажує його на кожному проході loop()
+  if (!sortTrace.Drain()) return;
+  Serial.println();
+  Serial.print("Записано подій: ");
+  Serial.print(sortTrace.Events());
+  Serial.print(", байтів: ");
+  Serial.print(sortTrace.Bytes());
+  if (sortTrace.Lost() > 0)
+  {
+    Serial.print(", втрачено: ");
+    Serial.print(sortTrace.Lost());
+  }
+  Serial.println();
+#endif
+
+  // Вивід відсортованого масиву
+  PrintArray(MyArr, MY_ARRAY_SIZE, "Масив після сортування (за зростанням):");
+
+  Serial.print("Порівнянь: ");
+  Serial.print(sortEngine.Comparisons());
+  Serial.print(", обмінів: ");
+  Serial.print(sortEngine.Swaps());
+  Serial.print(", час: ");
+  Serial.print(micros() - sortStartUs);
+  Serial.print(" мкс, найдовша порція: ");
+  Serial.print(sortMaxSliceUs);
+  Serial.println(" мкс\r\n");
+  MemDiagReport(Serial, F("після сортування"));
+
+  ShowPrompt("Натисніть будь-яку клавішу, щоб переглянути потокову медіану...");
+  stage = STAGE_STREAM;
 }
 
 // ===== Реалізація допоміжних функцій =====
 
 /**
- * @brief Заповнює масив випадковими цілими числами у заданому діапазоні.
+ * @brief Заповнює масив тестовими даними у заданому діапазоні.
  *
- * Ця функція генерує випадкові числа в межах від RND_MIN до RND_MAX включно
- * та записує їх у масив, переданий через параметри. Перед генерацією
- * виконується ініціалізація генератора випадкових чисел на основі показань
- * аналогового входу A0, що забезпечує більш випадкові результати.
+ * Ця функція генерує числа в межах від RND_MIN до RND_MAX включно
+ * та записує їх у масив, переданий через параметри. Вид даних задає
+ * WORKLOAD_KIND, а явне зерно WORKLOAD_SEED робить результат
+ * відтворюваним від запуску до запуску.
  *
  * @param arr Масив, який потрібно заповнити.
  * @param size Кількість елементів у масиві.
  */
 void FillArray(int arr[], int size)
 {
-  // Ініціалізація (засівання) генератора випадкових чисел
-  // analogRead(A0) читає "шумове" значення з нез'єднаного аналогового входу,
-  // що забезпечує непередбачувану початкову точку для randomSeed().
-  randomSeed(analogRead(A0));
-
-  // Цикл для заповнення кожного елемента масиву випадковим числом
-  for (int i = 0; i < size; i++)
-  {
-    // Генеруємо випадкове число в межах [RND_MIN, RND_MAX]
-    // Функція random() не включає верхню межу, тому додаємо +1
-    arr[i] = random(RND_MIN, RND_MAX + 1);
-  }
+  GenerateWorkload(arr, size, WORKLOAD_KIND, RND_MIN, RND_MAX, WORKLOAD_SEED, WORKLOAD_PARAM);
 
   // Виведення повідомлення у серійний монітор про завершення заповнення масиву
   Serial.println("Масив заповнено випадковими числами.\r\n");
@@ -174,29 +427,40 @@ void FillArray(int arr[], int size)
 
 
 /**
- * @brief Очікує натискання будь-якої клавіші через серійний монітор.
+ * @brief Виводить підказку користувачу у серійний монітор.
  *
- * Функція зупиняє виконання програми, доки користувач не введе будь-який символ
- * у серійному моніторі Arduino IDE. Це дозволяє реалізувати "покрокове"
- * виконання програми, щоб користувач міг спостерігати за кожним етапом.
+ * Саме очікування виконує loop() через KeyPressed(), тож програма
+ * "покрокова" для користувача, але не блокує процесор.
  *
  * @param msg Повідомлення, яке виводиться користувачу з поясненням,
  *            що необхідно зробити (наприклад, "Натисніть будь-яку клавішу...").
  */
-void WaitAnyKey(String msg)
+void ShowPrompt(String msg)
 {
-  // Виводимо повідомлення користувачу у серійний монітор.
-  // Наприклад: "Натисніть будь-яку клавішу, щоб продовжити..."
   Serial.println(msg);
+}
 
-  // Цикл очікує, доки користувач не введе символ у серійному моніторі.
-  // Serial.available() повертає кількість байтів, готових для зчитування.
-  // Якщо немає введення — виконується коротка затримка (10 мс), щоб не перевантажувати процесор.
-  while (!Serial.available()) delay(10);
 
-  // Зчитуємо один символ із вхідного буфера.
-  // Це очищає буфер і запобігає повторному спрацьовуванню на той самий ввід.
-  Serial.read();
+/**
+ * @brief Перевіряє, чи введено символ у серійному моніторі, не очікуючи на нього.
+ *
+ * Serial.available() повертає кількість байтів, готових для зчитування.
+ * Якщо символ є — зчитуємо його, щоб очистити буфер і запобігти
+ * повторному спрацьовуванню на той самий ввід. Клавіша m не рахується:
+ * замість неї виводиться звіт про пам’ять.
+ *
+ * @return true, якщо користувач натиснув клавішу.
+ */
+bool KeyPressed()
+{
+  if (!Serial.available()) return false;
+
+  if (Serial.read() == 'm')
+  {
+    MemDiagReport(Serial, F("за запитом"));
+    return false;
+  }
+  return true;
 }
 
 
@@ -285,3 +549,97 @@ void BubbleSort(int arr[], int size)
   // Виводимо повідомлення для користувача в монітор порту.
   Serial.println("Масив відсортовано.\r\n");
 }
+
+
+/**
+ * @brief Демонструє потокову медіану та перцентиль на ковзному вікні.
+ *
+ * «Сигнал» — повільно зростаюча пилка з випадковими одиничними викидами,
+ * подібна до показань АЦП потенціометра. Медіана вікна ігнорує викиди,
+ * при цьому вікно ніколи не сортується повністю: кожна вибірка вставляється
+ * на своє місце двійковим пошуком, а найстаріша витісняється.
+ */
+void StreamMedianDemo()
+{
+  SortedWindow window(WindowRing, WindowSorted, WINDOW_SIZE);
+  Xorshift32 rng(WORKLOAD_SEED);
+
+  Serial.println("Вибірка\tМедіана\tP90");
+
+  for (int i = 0; i < STREAM_LENGTH; i++)
+  {
+    // Повільний сигнал + рідкісні викиди
+    int sample = 10 + i * 2;
+    if (rng.Below(5) == 0) sample += rng.Range(RND_MIN, RND_MAX);
+
+    window.Push(sample);
+
+    Serial.print(sample);
+    Serial.print("\t");
+    Serial.print(window.Median());
+    Serial.print("\t");
+    Serial.println(window.Percentile(90));
+  }
+
+  Serial.println();
+}
+
+
+/**
+ * @brief Порівняння записів лише за номером каналу.
+ */
+bool ByChannel(const ChannelSample &a, const ChannelSample &b)
+{
+  return a.channel < b.channel;
+}
+
+/**
+ * @brief Виводить записи таблицею «час, канал, значення».
+ */
+void PrintRecords(const ChannelSample records[], uint8_t count)
+{
+  Serial.println("Час\tКанал\tЗначення");
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Serial.print(records[i].time);
+    Serial.print("\t");
+    Serial.print(records[i].channel);
+    Serial.print("\t");
+    Serial.println(records[i].value);
+  }
+  Serial.println();
+}
+
+void RecordSortDemo()
+{
+  Xorshift32 rng(WORKLOAD_SEED);
+  uint32_t time = 0;
+
+  for (uint8_t i = 0; i < RECORD_COUNT; i++)
+  {
+    time += 1 + rng.Below(20);
+    Records[i].time = time;
+    Records[i].channel = rng.Below(4);
+    Records[i].value = rng.Range(RND_MIN, RND_MAX);
+  }
+  PrintRecords(Records, RECORD_COUNT);
+
+  unsigned long start = micros();
+  ArgSort(Records, RecordOrder, RECORD_COUNT, ByChannel, ARGSORT_STABLE);
+  unsigned long sorted = micros();
+  uint16_t moves = ApplyPermutation(Records, RecordOrder, RECORD_COUNT);
+  unsigned long applied = micros();
+
+  Serial.println("Записи за каналом (у межах каналу — за часом):");
+  PrintRecords(Records, RECORD_COUNT);
+
+  Serial.print("Сортування індексів: ");
+  Serial.print(sorted - start);
+  Serial.print(" мкс, перестановка записів: ");
+  Serial.print(applied - sorted);
+  Serial.print(" мкс, копіювань записів: ");
+  Serial.print(moves);
+  Serial.print(" (розмір запису ");
+  Serial.print(sizeof(ChannelSample));
+  Serial.println(" Б)\r\n");
+}
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+Відтворення двійкового запису сортування (SortTrace) на комп’ютері.
+
+Скрипт читає потік з плати (середовище uno_trace) або з файлу, знаходить
+заголовок 'STR1', бере з нього початковий масив і застосовує до нього
+події порівняння/обміну, відновлюючи кожен проміжний стан масиву.
+Текст, який програма виводить до і після запису, пропускається.
+
+Приклади:
+    python sort_replay.py --port /dev/ttyACM0            # наживо з плати
+    python sort_replay.py --file capture.bin --states    # кожен стан після обміну
+    python sort_replay.py --file capture.bin --plot      # теплова карта станів (matplotlib)
+
+Формат описано у include/SortTrace.h.
+"""
+
+import argparse
+import sys
+
+MAGIC = b"STR1"
+TAG_COMPARE = 0xC0
+TAG_SWAP = 0xD0
+TAG_SET = 0xB0
+TAG_END = 0xE0
+TAG_NEXT = 0x01
+
+
+class ByteSource:
+    """Побайтове читання з файлу або серійного порту."""
+
+    def __init__(self, stream):
+        self.stream = stream
+
+    def byte(self):
+        b = self.stream.read(1)
+        while not b:
+            # Серійний порт з тайм-аутом повертає порожній рядок — чекаємо далі;
+            # файл, що закінчився, означає обірваний запис.
+            if not hasattr(self.stream, "in_waiting"):
+                raise EOFError("запис обірвано")
+            b = self.stream.read(1)
+        return b[0]
+
+    def varint(self):
+        value = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            value |= (b & 0x7F) << shift
+            if b < 0x80:
+                return value
+            shift += 7
+
+    def zigzag(self):
+        v = self.varint()
+        return (v >> 1) ^ -(v & 1)
+
+    def sync(self):
+        """Пропускає текст до заголовка запису; повертає пропущений текст."""
+        window = b""
+        skipped = bytearray()
+        while window != MAGIC:
+            b = self.byte()
+            window = (window + bytes([b]))[-len(MAGIC):]
+            skipped.append(b)
+        return bytes(skipped[:-len(MAGIC)])
+
+
+def replay(src, on_state=None):
+    """Відтворює один запис. Повертає (початковий, кінцевий масив, статистика)."""
+    n = src.varint()
+    initial = [src.zigzag() for _ in range(n)]
+    arr = list(initial)
+    stats = {"compares": 0, "swaps": 0, "sets": 0}
+
+    if on_state:
+        on_state(arr, None)
+
+    while True:
+        tag = src.byte()
+        if tag == TAG_END:
+            return initial, arr, stats
+
+        kind = tag & 0xF0
+        if kind == TAG_SET:
+            i = src.varint()
+            if not 0 <= i < n:
+                raise ValueError("індекс поза масивом: %d" % i)
+            arr[i] = src.zigzag()
+            stats["sets"] += 1
+            if on_state:
+                on_state(arr, (i,))
+            continue
+
+        i = src.varint()
+        j = i + 1 if tag & TAG_NEXT else src.varint()
+        if not (0 <= i < n and 0 <= j < n):
+            raise ValueError("індекс поза масивом: (%d, %d)" % (i, j))
+
+        if kind == TAG_COMPARE:
+            stats["compares"] += 1
+        elif kind == TAG_SWAP:
+            stats["swaps"] += 1
+            arr[i], arr[j] = arr[j], arr[i]
+            if on_state:
+                on_state(arr, (i, j))
+        else:
+            raise ValueError("невідомий тег 0x%02X" % tag)
+
+
+def format_state(arr, pair):
+    cells = []
+    for k, v in enumerate(arr):
+        cells.append("[%d]" % v if pair and k in pair else str(v))
+    return "\t".join(cells)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    group = parser.add_mutually_exclusive_group(required=True)
+    group.add_argument("--port", help="серійний порт плати")
+    group.add_argument("--file", help="файл із захопленим потоком")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--states", action="store_true", help="виводити стан після кожного обміну")
+    parser.add_argument("--plot", action="store_true", help="показати теплову карту станів")
+    args = parser.parse_args()
+
+    if args.port:
+        import serial  # pyserial
+        stream = serial.Serial(args.port, args.baud, timeout=1)
+    else:
+        stream = open(args.file, "rb")
+
+    src = ByteSource(stream)
+    text = src.sync()
+    if text.strip():
+        sys.stdout.write(text.decode("utf-8", "replace"))
+
+    states = []
+
+    def on_state(arr, pair):
+        if args.states:
+            print(format_state(arr, pair))
+        if args.plot:
+            states.append(list(arr))
+
+    initial, final, stats = replay(src, on_state)
+
+    print("Початковий масив: ", "\t".join(map(str, initial)))
+    print("Кінцевий масив:   ", "\t".join(map(str, final)))
+    print("Порівнянь: %d, обмінів: %d, записів: %d" % (stats["compares"], stats["swaps"], stats["sets"]))
+    ordered = final in (sorted(initial), sorted(initial, reverse=True))
+    if not ordered:
+        print("УВАГА: кінцевий масив не є відсортованим початковим!")
+        sys.exit(1)
+
+    if args.plot:
+        import matplotlib.pyplot as plt
+        plt.imshow(states, aspect="auto", interpolation="nearest", cmap="viridis")
+        plt.xlabel("індекс")
+        plt.ylabel("обмін №")
+        plt.colorbar(label="значення")
+        plt.title("Стани масиву під час сортування")
+        plt.show()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+/**
+ * @file Gauge.cpp
+ * @brief Реалізація рядка зі шкалою.
+ */
+
+#include "Gauge.h"
+
+/**
+ * @brief Кількість символів у десятковому записі числа (зі знаком).
+ */
+static uint8_t DecimalWidth(int value)
+{
+  uint8_t width = (value < 0) ? 2 : 1;
+  unsigned int magnitude = (value < 0) ? -(unsigned int)value : value;
+  while (magnitude >= 10)
+  {
+    magnitude /= 10;
+    width++;
+  }
+  return width;
+}
+
+/**
+ * @brief Дописує рядок, поки не досягнуто межі limit.
+ */
+static size_t Append(char buffer[], size_t pos, size_t limit, const char *text)
+{
+  while (*text && pos < limit) buffer[pos++] = *text++;
+  return pos;
+}
+
+size_t GaugeFormat(char buffer[], size_t size, const GaugeStyle &style, int value, int low, int high)
+{
+  // Місце для "]" і кінця рядка резервується заздалегідь
+  const size_t tail = style.inPlace ? 1 : 3;
+  if (size <= tail) return 0;
+  const size_t limit = size - tail;
+  size_t pos = 0;
+
+  if (style.inPlace) buffer[pos++] = '\r';
+  pos = Append(buffer, pos, limit, style.label);
+
+  // Значення; у режимі на місці — фіксованої ширини, щоб рядок не «стрибав»
+  if (style.inPlace)
+  {
+    uint8_t lowWidth = DecimalWidth(low);
+    uint8_t highWidth = DecimalWidth(high);
+    uint8_t field = (lowWidth > highWidth) ? lowWidth : highWidth;
+    for (uint8_t w = DecimalWidth(value); w < field && pos < limit; w++) buffer[pos++] = ' ';
+  }
+
+  char digits[7];
+  uint8_t count = 0;
+  unsigned int magnitude = (value < 0) ? -(unsigned int)value : value;
+  do
+  {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude != 0);
+  if (value < 0) digits[count++] = '-';
+  while (count > 0 && pos < limit) buffer[pos++] = digits[--count];
+
+  pos = Append(buffer, pos, limit, style.unit);
+  pos = Append(buffer, pos, limit, "[");
+
+  // Кількість заповнених поділок — як map(value, low, high, 0, width)
+  int clamped = (low < high) ? constrain(value, low, high) : constrain(value, high, low);
+  long filled = (high != low) ? (long)(clamped - low) * style.width / (high - low) : 0;
+  for (uint8_t i = 0; i < style.width && pos < limit; i++)
+  {
+    buffer[pos++] = (i < filled) ? style.fill : style.empty;
+  }
+
+  buffer[pos++] = ']';
+  if (!style.inPlace)
+  {
+    buffer[pos++] = '\r';
+    buffer[pos++] = '\n';
+  }
+  return pos;
+}
+
+size_t GaugePrint(Print &out, const GaugeStyle &style, int value, int low, int high)
+{
+  char line[GAUGE_LINE_MAX];
+  size_t len = GaugeFormat(line, sizeof(line), style, value, low, high);
+  return out.write((const uint8_t *)line, len);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Gauge.h
+ * @brief Вивід значення зі шкалою одним рядком без динамічної пам’яті.
+ *
+ * Рядок «<підпис><значення><одиниця>[####------]» формується за один
+ * прохід у буфері на стеку й передається одним викликом write(), замість
+ * окремого Serial.print() на кожну поділку шкали. Ширину шкали та символи
+ * поділок задає GaugeStyle; з прапорцем inPlace рядок починається з '\r'
+ * і не переводить рядок, тож термінал (наприклад, pio device monitor)
+ * перемальовує його на місці.
+ *
+ * @example
+ *  const GaugeStyle ANGLE_GAUGE = { "Кут: ", "° ", 20, '#', '-', false };
+ *  GaugePrint(Serial, ANGLE_GAUGE, angle, 0, 180);
+ *  // Кут: 90° [##########----------]
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef GAUGE_H
+#define GAUGE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Найдовший рядок, що формується на стеку (байтів UTF-8).
+ *
+ * Довші рядки обрізаються по шкалі — кінець рядка зберігається завжди.
+ */
+const uint8_t GAUGE_LINE_MAX = 128;
+
+/**
+ * @brief Оформлення рядка зі шкалою.
+ */
+struct GaugeStyle
+{
+  const char *label;   ///< Текст перед значенням
+  const char *unit;    ///< Текст після значення (одиниця та відступ до шкали)
+  uint8_t width;       ///< Кількість поділок шкали
+  char fill;           ///< Символ заповненої поділки
+  char empty;          ///< Символ порожньої поділки
+  bool inPlace;        ///< Перемальовувати рядок на місці ('\r' замість переводу рядка)
+};
+
+/**
+ * @brief Формує рядок зі шкалою у наданому буфері.
+ *
+ * @param buffer Буфер для рядка (без завершального нуля).
+ * @param size   Розмір буфера.
+ * @param style  Оформлення.
+ * @param value  Значення (для шкали обмежується діапазоном low..high).
+ * @param low    Значення, що відповідає порожній шкалі.
+ * @param high   Значення, що відповідає повній шкалі.
+ * @return Довжина рядка в байтах.
+ */
+size_t GaugeFormat(char buffer[], size_t size, const GaugeStyle &style, int value, int low, int high);
+
+/**
+ * @brief Формує рядок на стеку та виводить його одним write().
+ *
+ * @return Кількість переданих байтів.
+ */
+size_t GaugePrint(Print &out, const GaugeStyle &style, int value, int low, int high);
+
+#endif  // GAUGE_H
@@ -0,0 +1,163 @@
+/**
+ * @file Idle.cpp
+ * @brief Реалізація енергоощадного очікування та вимірювань АЦП у сні.
+ *
+ * Вхід у сон завжди виконується за схемою «cli → перевірка умов →
+ * sleep_enable → sei → sleep_cpu»: інструкція після sei виконується до
+ * будь-якого переривання, тож подія, що настала після перевірки, не може
+ * «загубитися» і залишити ядро спати до наступного тіку.
+ */
+
+#include "Idle.h"
+
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega168__)
+#error "Idle: підтримуються лише ATmega328P/168 (Uno, Nano)"
+#endif
+
+static volatile bool pinEvent;           ///< Була зміна рівня на зареєстрованому піні
+static HardwareSerial *wakeSerial;       ///< Порт, прихід байта на який будить
+static volatile unsigned long sleeps;    ///< Кількість входів у сон
+
+/**
+ * @brief Обробник зовнішнього переривання: лише позначає подію.
+ */
+static void OnWakePin()
+{
+  pinEvent = true;
+}
+
+// Переривання АЦП потрібне лише для пробудження з ADC Noise Reduction
+EMPTY_INTERRUPT(ADC_vect);
+
+bool IdleWakeOnPin(uint8_t pin)
+{
+  int irq = digitalPinToInterrupt(pin);
+  if (irq == NOT_AN_INTERRUPT) return false;
+
+  attachInterrupt(irq, OnWakePin, CHANGE);
+  return true;
+}
+
+void IdleWakeOnSerial(HardwareSerial &port)
+{
+  wakeSerial = &port;
+}
+
+/**
+ * @brief Чи настала подія, що завершує очікування (викликається при cli).
+ */
+static bool EventPending(IdleReady ready)
+{
+  if (pinEvent) return true;
+  if (wakeSerial != NULL && wakeSerial->available() > 0) return true;
+  return ready != NULL && ready();
+}
+
+bool IdleUntil(unsigned long wakeAtMs, IdleReady ready)
+{
+  set_sleep_mode(SLEEP_MODE_IDLE);
+
+  for (;;)
+  {
+    cli();
+    if (EventPending(ready))
+    {
+      pinEvent = false;
+      sei();
+      return true;
+    }
+    if ((long)(millis() - wakeAtMs) >= 0)
+    {
+      sei();
+      return false;
+    }
+
+    sleeps++;
+    sleep_enable();
+    sei();
+    sleep_cpu();      // Будить будь-яке переривання, щонайменше Timer0 раз на 1 мс
+    sleep_disable();
+  }
+}
+
+/**
+ * @brief Чи передає USART0 (викликається при cli).
+ *
+ * У ADC Noise Reduction зупиняється clkI/O, і передавач завмирає посеред
+ * символу. HardwareSerial скидає TXC0 при кожному записі, а UDRIE0 увімкнено,
+ * поки в його буфері є байти, тож вільний передавач — це TXC0 і вимкнене UDRIE0.
+ * До першого надісланого байта TXC0 теж скинутий — тоді просто не спимо.
+ */
+static bool SerialSending()
+{
+  if (!(UCSR0B & _BV(TXEN0))) return false;
+  return (UCSR0B & _BV(UDRIE0)) || !(UCSR0A & _BV(TXC0));
+}
+
+int IdleAnalogRead(uint8_t pin, uint8_t quietPin)
+{
+  if (pin >= A0) pin -= A0;
+
+  // Рівень піна читаємо з регістра PINx: digitalRead() вимикає ШІМ на
+  // пінах таймерів, а це зірвало б апаратний канал ServoBank (OC1A/OC1B)
+  volatile uint8_t *quietPort = NULL;
+  uint8_t quietMask = 0;
+  if (quietPin != 0xFF)
+  {
+    quietPort = portInputRegister(digitalPinToPort(quietPin));
+    quietMask = digitalPinToBitMask(quietPin);
+  }
+
+  ADMUX = _BV(REFS0) | (pin & 0x07);                 // AVcc, обраний канал
+  ADCSRA |= _BV(ADEN) | _BV(ADIF);                   // Скидаємо старий прапорець
+  ADCSRA |= _BV(ADIE);
+
+  set_sleep_mode(SLEEP_MODE_ADC);
+
+  bool sending;
+  for (;;)
+  {
+    cli();
+    sending = SerialSending();
+    if (sending) break;
+    // Таймер сервоприводу не повинен зупинитися посеред імпульсу
+    if (quietPort == NULL || !(*quietPort & quietMask)) break;
+    sei();
+  }
+
+  if (sending)
+  {
+    // Порт ще передає: звичайне перетворення без сну, щоб не спотворити символ
+    sei();
+    ADCSRA |= _BV(ADSC);
+  }
+  else
+  {
+    // Вхід у сон сам запускає перетворення; якщо ядро розбудило інше
+    // переривання, перетворення триває, і ми дочікуємося його вже без сну
+    sleeps++;
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+  }
+
+  while (ADCSRA & _BV(ADSC))
+  {
+  }
+
+  ADCSRA &= ~_BV(ADIE);
+  return ADC;
+}
+
+unsigned long IdleSleepCount()
+{
+  uint8_t oldSREG = SREG;
+  cli();
+  unsigned long count = sleeps;
+  SREG = oldSREG;
+  return count;
+}
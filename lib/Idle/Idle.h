@@ -0,0 +1,93 @@
+/**
+ * @file Idle.h
+ * @brief Енергоощадне очікування між подіями та «тихе» вимірювання АЦП.
+ *
+ * Замість порожнього обертання loop() або delay() мікроконтролер засинає
+ * в режимі IDLE — найглибшому, у якому ще працюють Timer0 (millis),
+ * Timer1 (сервоприводи), Timer2 (IRremote) та UART. Будь-яке переривання
+ * будить ядро, після чого IdleUntil() перевіряє, чи настала подія:
+ *
+ * - зміна рівня на піні, зареєстрованому IdleWakeOnPin() (INT0/INT1);
+ * - байт у приймальному буфері порту, зареєстрованого IdleWakeOnSerial();
+ * - умова користувача (наприклад, прийнято ІЧ-кадр);
+ * - досягнуто заданого моменту часу (тік планувальника).
+ *
+ * Якщо ні — ядро засинає знову. Timer0 будить його щонайменше раз на 1 мс.
+ *
+ * IdleAnalogRead() виконує перетворення АЦП у режимі ADC Noise Reduction:
+ * ядро та тактування вводу-виводу зупиняються, тож цифровий шум не
+ * потрапляє у вимірювання. У цьому режимі стоять і таймери, тому перед
+ * сном функція чекає, доки пін сервоприводу стане низьким: таймер, що
+ * стоїть у паузі між імпульсами, не подовжує імпульс.
+ *
+ * Лише для AVR (ATmega328P/168).
+ *
+ * @example
+ *  IdleWakeOnSerial(Serial);
+ *  unsigned long next = millis();
+ *  for (;;) {
+ *    next += 20;
+ *    IdleUntil(next);                         // сон до наступного тіку
+ *    int value = IdleAnalogRead(A0, SERVO_PIN);
+ *  }
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef IDLE_H
+#define IDLE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Умова пробудження, яку перевіряє IdleUntil() після кожного переривання.
+ */
+typedef bool (*IdleReady)();
+
+/**
+ * @brief Реєструє пін, зміна рівня на якому завершує IdleUntil().
+ *
+ * @param pin Пін із зовнішнім перериванням (на Uno — D2 або D3).
+ * @return false, якщо пін не підтримує зовнішнє переривання.
+ */
+bool IdleWakeOnPin(uint8_t pin);
+
+/**
+ * @brief Реєструє порт, прихід байта на який завершує IdleUntil().
+ */
+void IdleWakeOnSerial(HardwareSerial &port);
+
+/**
+ * @brief Спить у режимі IDLE до моменту wakeAtMs або до події.
+ *
+ * @param wakeAtMs Момент пробудження за millis() (переповнення враховано).
+ * @param ready    Додаткова умова пробудження (NULL — немає).
+ * @return true — розбудила подія, false — настав час wakeAtMs.
+ */
+bool IdleUntil(unsigned long wakeAtMs, IdleReady ready = NULL);
+
+/**
+ * @brief Зчитує аналоговий вхід у режимі сну ADC Noise Reduction.
+ *
+ * Використовує опорну напругу AVcc (як analogRead() за замовчуванням).
+ * Кожне вимірювання у сні зупиняє millis() приблизно на 0,1 мс; UART теж
+ * стоїть, тож байт, що надходить саме в цей момент, може бути спотворений.
+ * Передачу сон не перериває: поки USART0 надсилає дані (байти в буфері
+ * Serial або символ у зсувному регістрі), вимірювання виконується без сну —
+ * так само точно за часом, але без зниження шуму.
+ *
+ * @param pin      Аналоговий вхід (A0–A7 або 0–7).
+ * @param quietPin Пін сервоприводу, низького рівня якого слід дочекатися
+ *                 перед сном (0xFF — не чекати).
+ * @return Результат 0–1023.
+ */
+int IdleAnalogRead(uint8_t pin, uint8_t quietPin = 0xFF);
+
+/**
+ * @brief Кількість входів у сон з моменту запуску (для оцінки простою).
+ */
+unsigned long IdleSleepCount();
+
+#endif  // IDLE_H
@@ -0,0 +1,128 @@
+/**
+ * @file MemDiag.cpp
+ * @brief Реалізація діагностики SRAM для AVR.
+ */
+
+#include "MemDiag.h"
+
+#ifndef __AVR__
+#error "MemDiag: лише для AVR (символи __heap_start, __brkval, __flp з avr-libc)"
+#endif
+
+static const uint8_t PAINT = 0xC5;  ///< Шаблон недоторканої пам’яті
+
+// Символи компонувальника та avr-libc
+extern uint8_t __data_start;
+extern uint8_t __bss_end;
+extern uint8_t __heap_start;
+extern char *__brkval;
+
+/**
+ * @brief Вільний блок купи (внутрішня структура malloc з avr-libc).
+ */
+struct __freelist
+{
+  size_t sz;
+  struct __freelist *nx;
+};
+extern struct __freelist *__flp;
+
+static uint16_t heapPeak;   ///< Найбільша купа серед знімків
+
+/**
+ * @brief Заповнює пам’ять між купою і стеком шаблоном ще до конструкторів.
+ *
+ * .init3 виконується після обнулення r1 і налаштування стека, але до
+ * ініціалізації .data/.bss та конструкторів, тож стек ще порожній.
+ */
+void MemDiagPaint() __attribute__((naked, used, section(".init3")));
+void MemDiagPaint()
+{
+  uint8_t *p = &__heap_start;
+  while (p < (uint8_t *)SP) *p++ = PAINT;
+}
+
+static uint8_t *HeapEnd()
+{
+  return (__brkval != 0) ? (uint8_t *)__brkval : &__heap_start;
+}
+
+void MemDiagSnapshot(MemStats &stats)
+{
+  uint8_t oldSREG = SREG;
+  cli();
+
+  uint8_t *heapEnd = HeapEnd();
+  uint8_t *sp = (uint8_t *)SP;
+
+  stats.staticBytes = &__bss_end - &__data_start;
+  stats.heapBytes = heapEnd - &__heap_start;
+  if (stats.heapBytes > heapPeak) heapPeak = stats.heapBytes;
+  stats.heapPeak = heapPeak;
+
+  stats.freeListBytes = 0;
+  stats.freeListBlocks = 0;
+  stats.largestFree = 0;
+  for (struct __freelist *f = __flp; f != NULL; f = f->nx)
+  {
+    stats.freeListBytes += f->sz;
+    stats.freeListBlocks++;
+    if (f->sz > stats.largestFree) stats.largestFree = f->sz;
+  }
+
+  SREG = oldSREG;
+
+  stats.gapBytes = (sp > heapEnd) ? sp - heapEnd : 0;
+  stats.stackBytes = (uint8_t *)RAMEND - sp;
+
+  // Шаблон шукаємо над найвищою вершиною купи: нижче пам’ять могла
+  // належати купі, і її «забрудненість» не означає роботи стека.
+  // Перегляд (до ~0,5 мс) іде з дозволеними перериваннями, щоб не затримувати
+  // таймери IRremote і ServoBank; стек, що виріс тим часом, лише уточнює позначку.
+  uint8_t *p = &__heap_start + stats.heapPeak;
+  uint8_t *bottom = p;
+  while (p < sp && *p == PAINT) p++;
+  stats.neverUsed = p - bottom;
+  stats.stackPeak = (uint8_t *)RAMEND - p + 1;
+  if (stats.stackPeak < stats.stackBytes) stats.stackPeak = stats.stackBytes;
+
+  // Одним malloc можна отримати або найбільший вільний блок, або
+  // частину проміжку до стека (за вирахуванням запасу __malloc_margin)
+  uint16_t gapUsable = (stats.gapBytes > __malloc_margin) ? stats.gapBytes - __malloc_margin : 0;
+  if (gapUsable > stats.largestFree) stats.largestFree = gapUsable;
+
+  uint16_t totalFree = stats.freeListBytes + gapUsable;
+  stats.fragmentation = totalFree ? 100 - (uint32_t)stats.largestFree * 100 / totalFree : 0;
+}
+
+void MemDiagReport(Print &out, const __FlashStringHelper *label)
+{
+  MemStats s;
+  MemDiagSnapshot(s);
+
+  out.print(F("[MEM] "));
+  if (label != NULL) out.print(label);
+  out.print(F("\r\n  статичні: "));
+  out.print(s.staticBytes);
+  out.print(F(" Б, купа: "));
+  out.print(s.heapBytes);
+  out.print(F(" Б (пік "));
+  out.print(s.heapPeak);
+  out.print(F("), вільних блоків: "));
+  out.print(s.freeListBlocks);
+  out.print(F(" ("));
+  out.print(s.freeListBytes);
+  out.print(F(" Б), найбільший malloc: "));
+  out.print(s.largestFree);
+  out.print(F(" Б, фрагментація: "));
+  out.print(s.fragmentation);
+  out.print(F("%\r\n  стек: "));
+  out.print(s.stackBytes);
+  out.print(F(" Б (пік "));
+  out.print(s.stackPeak);
+  out.print(F("), між купою і стеком: "));
+  out.print(s.gapBytes);
+  out.print(F(" Б, ніколи не використано: "));
+  out.print(s.neverUsed);
+  out.println(F(" Б"));
+}
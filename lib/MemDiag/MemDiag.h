@@ -0,0 +1,69 @@
+/**
+ * @file MemDiag.h
+ * @brief Діагностика SRAM: пік стека, використання та фрагментація купи.
+ *
+ * На ATmega328P лише 2 КБ SRAM: знизу статичні змінні (.data/.bss), над
+ * ними купа (malloc, String), а згори назустріч їй росте стек. Зіткнення
+ * непомітне — програма просто поводиться дивно. Модуль показує, скільки
+ * запасу реально лишається:
+ *
+ * - ще до конструкторів і main() (секція .init3) вільна область між
+ *   купою і стеком заповнюється шаблоном 0xC5; під час звіту шаблон,
+ *   що лишився недоторканим, показує найглибшу точку, куди сягав стек;
+ * - стан купи береться з avr-libc: __brkval (вершина купи) і список
+ *   вільних блоків __flp — звідси вільна пам’ять усередині купи,
+ *   найбільший блок і фрагментація (частка вільної пам’яті, яку не
+ *   можна отримати одним malloc);
+ * - пік купи запам’ятовується в кожному звіті, тож варто викликати
+ *   MemDiagReport() у контрольних точках після найбільших виділень.
+ *
+ * Скільки пам’яті займає кожен модуль статично, показує під час збірки
+ * скрипт tools/mem_report.py (extra_scripts у platformio.ini).
+ *
+ * Лише для AVR.
+ *
+ * @example
+ *  if (Serial.peek() == 'm') { Serial.read(); MemDiagReport(Serial, F("за запитом")); }
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef MEMDIAG_H
+#define MEMDIAG_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Знімок стану пам’яті (усі розміри — у байтах).
+ */
+struct MemStats
+{
+  uint16_t staticBytes;    ///< .data + .bss
+  uint16_t heapBytes;      ///< Купа зараз (від __heap_start до __brkval)
+  uint16_t heapPeak;       ///< Найбільша купа серед усіх знімків
+  uint16_t freeListBytes;  ///< Вільні блоки всередині купи
+  uint8_t freeListBlocks;  ///< Кількість вільних блоків
+  uint16_t gapBytes;       ///< Між вершиною купи і стеком зараз
+  uint16_t largestFree;    ///< Найбільший блок, який може повернути malloc
+  uint8_t fragmentation;   ///< % вільної пам’яті, недоступної одним блоком
+  uint16_t stackBytes;     ///< Стек зараз
+  uint16_t stackPeak;      ///< Найглибший стек з моменту запуску
+  uint16_t neverUsed;      ///< Пам’ять, якої не торкалися ні купа, ні стек
+};
+
+/**
+ * @brief Знімає поточний стан пам’яті та оновлює пік купи.
+ */
+void MemDiagSnapshot(MemStats &stats);
+
+/**
+ * @brief Виводить знімок пам’яті у зручному для читання вигляді.
+ *
+ * @param out   Куди виводити (зазвичай Serial).
+ * @param label Назва контрольної точки (рядок у flash, F("...")).
+ */
+void MemDiagReport(Print &out, const __FlashStringHelper *label = NULL);
+
+#endif  // MEMDIAG_H
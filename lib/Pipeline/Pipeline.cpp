@@ -0,0 +1,32 @@
+/**
+ * @file Pipeline.cpp
+ * @brief Звіт про лічильники етапів конвеєра.
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#include "Pipeline.h"
+
+void PipelineReportStage(Print &out, uint8_t index, const __FlashStringHelper *name,
+                         const PipelineStats &stats)
+{
+  out.print(F("  "));
+  out.print(index);
+  out.print(F(". "));
+  out.print(name);
+  out.print(F(": "));
+  out.print(stats.calls);
+  out.print(F(" / "));
+  out.print(stats.passed);
+#ifdef PIPELINE_NO_TIMING
+  out.println();
+#else
+  out.print(F(", "));
+  out.print(stats.calls ? stats.totalUs / stats.calls : 0);
+  out.print(F(" / "));
+  out.print(stats.maxUs);
+  out.println(F(" мкс"));
+#endif
+}
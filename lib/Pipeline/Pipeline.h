@@ -0,0 +1,253 @@
+/**
+ * @file Pipeline.h
+ * @brief Конвеєр «джерело → фільтри → планувальник → виконавчий пристрій», зібраний під час компіляції.
+ *
+ * Servo_Pot (потенціометр → кут → серво), MonToServo (порт → перевірка →
+ * серво) та IR_Control (пульт → режим → LED/серво) — один і той самий
+ * потік даних. Pipeline описує його як ланцюжок етапів, тип якого
+ * складається з типів етапів:
+ *
+ *  Pipeline<PotSource, MapStage, ServoStage> pipeline(pot, toAngle, servo);
+ *
+ * Виклики етапів — звичайні (не віртуальні) виклики методів, які
+ * компілятор вбудовує; жодної динамічної пам’яті: конвеєр зберігає лише
+ * посилання на етапи та лічильники часу. Етапи — глобальні об’єкти
+ * програми зі своїми конструкторами й станом.
+ *
+ * Вимоги до етапів:
+ * - джерело: typedef ... Output; bool Poll(Output &out) — false, якщо
+ *   нових даних немає;
+ * - фільтр, планувальник, виконавчий пристрій: typedef ... Output;
+ *   bool Process(const In &in, Output &out), де In — Output попереднього
+ *   етапу; false зупиняє проходження значення далі (відхилено або вже
+ *   оброблено);
+ * - усі: const __FlashStringHelper *Name() const — назва для звіту.
+ *
+ * Для кожного етапу рахуються виклики, передані далі значення, сумарний і
+ * найдовший час Process()/Poll() (за micros(), крок 4 мкс). Прапорець
+ * збірки PIPELINE_NO_TIMING вимикає вимірювання часу — лишаються лічильники.
+ *
+ * Типові етапи — у PipelineStages.h.
+ *
+ * @example
+ *  pipeline.Run();                        // джерело → усі етапи
+ *  pipeline.Feed<2>(angle);               // значення одразу в етап №2
+ *  pipeline.Report(Serial);               // час і лічильники етапів
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Лічильники одного етапу.
+ */
+struct PipelineStats
+{
+  uint32_t calls;     ///< Викликів Poll()/Process()
+  uint32_t passed;    ///< Значень, переданих далі
+  uint32_t totalUs;   ///< Сумарний час етапу, мкс
+  uint32_t maxUs;     ///< Найдовший виклик, мкс
+
+  void Reset()
+  {
+    calls = passed = totalUs = 0;
+    maxUs = 0;
+  }
+
+  void Record(unsigned long us, bool pass)
+  {
+    calls++;
+    if (pass) passed++;
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+  }
+};
+
+#ifdef PIPELINE_NO_TIMING
+#define PIPELINE_CLOCK() 0
+#else
+#define PIPELINE_CLOCK() micros()
+#endif
+
+/**
+ * @brief Виводить рядок звіту для одного етапу (реалізація — Pipeline.cpp).
+ */
+void PipelineReportStage(Print &out, uint8_t index, const __FlashStringHelper *name,
+                         const PipelineStats &stats);
+
+/**
+ * @brief Номер етапу як тип — для вибору етапу під час компіляції.
+ */
+template <uint8_t N>
+struct PipelineAt
+{
+};
+
+/**
+ * @brief Ланцюжок етапів після джерела (службовий клас Pipeline).
+ */
+template <typename In, typename... Stages>
+class PipelineChain;
+
+template <typename In>
+class PipelineChain<In>
+{
+public:
+  bool Push(const In &) { return true; }
+  template <typename V>
+  bool PushAt(PipelineAt<0>, const V &) { return true; }
+  const PipelineStats *Stats(uint8_t) const { return NULL; }
+  const __FlashStringHelper *Name(uint8_t) const { return NULL; }
+  void ResetStats() {}
+};
+
+template <typename In, typename First, typename... Rest>
+class PipelineChain<In, First, Rest...>
+{
+public:
+  explicit PipelineChain(First &first, Rest &...rest) : _stage(first), _rest(rest...)
+  {
+    _stats.Reset();
+  }
+
+  /**
+   * @brief Пропускає значення через цей етап і всі наступні.
+   *
+   * @return true, якщо значення дійшло до кінця конвеєра.
+   */
+  bool Push(const In &in)
+  {
+    typename First::Output out;
+    unsigned long start = PIPELINE_CLOCK();
+    bool pass = _stage.Process(in, out);
+    _stats.Record(PIPELINE_CLOCK() - start, pass);
+    return pass && _rest.Push(out);
+  }
+
+  template <uint8_t N, typename V>
+  bool PushAt(PipelineAt<N>, const V &value)
+  {
+    return _rest.PushAt(PipelineAt<N - 1>(), value);
+  }
+
+  template <typename V>
+  bool PushAt(PipelineAt<0>, const V &value)
+  {
+    return Push(value);
+  }
+
+  const PipelineStats *Stats(uint8_t index) const
+  {
+    return index == 0 ? &_stats : _rest.Stats(index - 1);
+  }
+
+  const __FlashStringHelper *Name(uint8_t index) const
+  {
+    return index == 0 ? _stage.Name() : _rest.Name(index - 1);
+  }
+
+  void ResetStats()
+  {
+    _stats.Reset();
+    _rest.ResetStats();
+  }
+
+private:
+  First &_stage;
+  PipelineStats _stats;
+  PipelineChain<typename First::Output, Rest...> _rest;
+};
+
+/**
+ * @brief Конвеєр: джерело та етапи, що обробляють його значення по черзі.
+ *
+ * Етап 0 — джерело, етапи 1…STAGES-1 — у порядку параметрів шаблону.
+ */
+template <typename Source, typename... Stages>
+class Pipeline
+{
+public:
+  static const uint8_t STAGES = 1 + sizeof...(Stages);  ///< Етапів разом із джерелом
+
+  explicit Pipeline(Source &source, Stages &...stages) : _source(source), _chain(stages...)
+  {
+    _stats.Reset();
+  }
+
+  /**
+   * @brief Опитує джерело і пропускає нове значення через усі етапи.
+   *
+   * @return true, якщо значення дійшло до кінця конвеєра.
+   */
+  bool Run()
+  {
+    typename Source::Output value;
+    unsigned long start = PIPELINE_CLOCK();
+    bool got = _source.Poll(value);
+    _stats.Record(PIPELINE_CLOCK() - start, got);
+    return got && _chain.Push(value);
+  }
+
+  /**
+   * @brief Подає значення одразу на вхід етапу N, минаючи попередні.
+   *
+   * Наприклад, відтворений із запису кут — після етапу перетворення
+   * сигналу потенціометра в кут. Тип значення — вхідний тип етапу N.
+   */
+  template <uint8_t N, typename V>
+  bool Feed(const V &value)
+  {
+    static_assert(N >= 1 && N < STAGES, "Pipeline::Feed: номер етапу 1..STAGES-1");
+    return _chain.PushAt(PipelineAt<N - 1>(), value);
+  }
+
+  /**
+   * @brief Лічильники етапу (0 — джерело).
+   */
+  const PipelineStats &Stats(uint8_t index) const
+  {
+    return index == 0 ? _stats : *_chain.Stats(index - 1);
+  }
+
+  /**
+   * @brief Назва етапу (0 — джерело).
+   */
+  const __FlashStringHelper *Name(uint8_t index) const
+  {
+    return index == 0 ? _source.Name() : _chain.Name(index - 1);
+  }
+
+  /**
+   * @brief Обнуляє лічильники всіх етапів.
+   */
+  void ResetStats()
+  {
+    _stats.Reset();
+    _chain.ResetStats();
+  }
+
+  /**
+   * @brief Виводить звіт: для кожного етапу виклики, передані значення, час.
+   */
+  void Report(Print &out) const
+  {
+    out.println(F("[PIPE] етап: викликів / далі, середній / найдовший час"));
+    for (uint8_t i = 0; i < STAGES; i++)
+    {
+      PipelineReportStage(out, i, Name(i), Stats(i));
+    }
+  }
+
+private:
+  Source &_source;
+  PipelineStats _stats;
+  PipelineChain<typename Source::Output, Stages...> _chain;
+};
+
+#endif  // PIPELINE_H
@@ -0,0 +1,102 @@
+/**
+ * @file PipelineStages.h
+ * @brief Типові етапи конвеєра Pipeline для цілих значень (АЦП, кути).
+ *
+ * - MapStage     — лінійне перетворення діапазону (як map());
+ * - Deadband     — зона нечутливості: тримає значення, поки зміна не
+ *                  перевищить поріг (придушує тремтіння потенціометра);
+ * - ChangeFilter — пропускає значення далі, лише якщо воно змінилося
+ *                  щонайменше на поріг (наприклад, щоб не засипати порт).
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef PIPELINESTAGES_H
+#define PIPELINESTAGES_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Перетворює [inLow, inHigh] у [outLow, outHigh].
+ */
+class MapStage
+{
+public:
+  typedef int Output;
+
+  MapStage(long inLow, long inHigh, long outLow, long outHigh)
+    : _inLow(inLow), _inHigh(inHigh), _outLow(outLow), _outHigh(outHigh) {}
+
+  bool Process(const int &in, int &out)
+  {
+    out = map(in, _inLow, _inHigh, _outLow, _outHigh);
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("map"); }
+
+private:
+  long _inLow, _inHigh, _outLow, _outHigh;
+};
+
+/**
+ * @brief Зона нечутливості: вихід змінюється, лише коли вхід відійшов більш ніж на band.
+ */
+class Deadband
+{
+public:
+  typedef int Output;
+
+  explicit Deadband(int band) : _band(band), _held(0) {}
+
+  /**
+   * @brief Починає з заданого значення (наприклад, на початку запису).
+   */
+  void Reset(int value) { _held = value; }
+
+  bool Process(const int &in, int &out)
+  {
+    if (abs(in - _held) > _band) _held = in;
+    out = _held;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("deadband"); }
+
+private:
+  int _band;
+  int _held;
+};
+
+/**
+ * @brief Пропускає значення, що відрізняється від останнього пропущеного щонайменше на threshold.
+ *
+ * Перше значення пропускається завжди.
+ */
+class ChangeFilter
+{
+public:
+  typedef int Output;
+
+  explicit ChangeFilter(int threshold) : _threshold(threshold), _last(0), _primed(false) {}
+
+  bool Process(const int &in, int &out)
+  {
+    if (_primed && abs(in - _last) < _threshold) return false;
+    _primed = true;
+    _last = in;
+    out = in;
+    return true;
+  }
+
+  const __FlashStringHelper *Name() const { return F("change"); }
+
+private:
+  int _threshold;
+  int _last;
+  bool _primed;
+};
+
+#endif  // PIPELINESTAGES_H
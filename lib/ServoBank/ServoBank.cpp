@@ -0,0 +1,346 @@
+/**
+ * @file ServoBank.cpp
+ * @brief Реалізація багатоканального драйвера сервоприводів на Timer1.
+ *
+ * Таймер працює у звичайному режимі (0…0xFFFF, подільник 8, 0,5 мкс на такт
+ * при 16 МГц). Кадр — це не переповнення таймера, а відлік від _aFrame/_bFrame,
+ * який щоразу збільшується на FRAME_TICKS; порівняння працює за модулем 2^16.
+ *
+ * Два ланцюжки подій:
+ * - COMPA: початок кадру (апаратне «встановити» OC1A) → кінець імпульсу на
+ *   піні 9 (апаратне «скинути» OC1A) → наступний кадр. Саме тут на межі кадру
+ *   підміняється розклад, тому COMPA працює завжди, навіть без піна 9.
+ * - COMPB: початок кадру (піднімаються програмні піни, апаратно — OC1B) →
+ *   групи спадних фронтів за зростанням часу → наступний кадр.
+ *
+ * Обидва збіги в момент початку кадру настають в один такт; COMPA має вищий
+ * пріоритет, тож COMPB завжди бачить уже підмінений розклад.
+ */
+
+#include "ServoBank.h"
+
+#if !defined(__AVR_ATmega328P__) && !defined(__AVR_ATmega168__)
+#error "ServoBank: підтримуються лише ATmega328P/168 (Uno, Nano): OC1A = D9, OC1B = D10"
+#endif
+
+// ----------------------------------------------------------
+//                  Параметри таймера
+// ----------------------------------------------------------
+
+static const uint16_t TICKS_PER_US = F_CPU / 8 / 1000000UL;                   ///< Тактів Timer1 на мікросекунду
+static const uint16_t FRAME_TICKS = ServoBank::REFRESH_US * TICKS_PER_US;   ///< Тактів у кадрі
+static const int16_t GUARD_TICKS = 24 * TICKS_PER_US;  ///< Ближчі події обробляються в тому самому перериванні
+static const uint8_t HW_PIN_A = 9;                     ///< OC1A
+static const uint8_t HW_PIN_B = 10;                    ///< OC1B
+
+// Біти COM1x у TCCR1A: 10 — скинути вихід при збігу, 11 — встановити
+static const uint8_t COM_A_MASK = _BV(COM1A1) | _BV(COM1A0);
+static const uint8_t COM_A_CLEAR = _BV(COM1A1);
+static const uint8_t COM_A_SET = _BV(COM1A1) | _BV(COM1A0);
+static const uint8_t COM_B_MASK = _BV(COM1B1) | _BV(COM1B0);
+static const uint8_t COM_B_CLEAR = _BV(COM1B1);
+static const uint8_t COM_B_SET = _BV(COM1B1) | _BV(COM1B0);
+
+// ----------------------------------------------------------
+//          Стан, спільний з обробниками переривань
+// ----------------------------------------------------------
+
+static ServoSchedule schedules[2];        ///< Активний і фоновий розклади
+static volatile uint8_t activeSchedule;   ///< Індекс розкладу, за яким працюють переривання
+static volatile uint8_t pendingReady;     ///< Фоновий розклад готовий до підміни на межі кадру
+static volatile bool hardwareA;           ///< Пін 9 підключено як апаратний канал
+static volatile bool hardwareB;           ///< Пін 10 підключено як апаратний канал
+static uint16_t aFrame;                   ///< Початок поточного кадру для ланцюжка COMPA
+static uint16_t bFrame;                   ///< Початок поточного кадру для ланцюжка COMPB
+static uint8_t aPhase;                    ///< 0 — чекаємо початку кадру, 1 — кінця імпульсу OC1A
+static uint8_t bIndex;                    ///< 0 — чекаємо початку кадру, k — k-ї групи фронтів
+static volatile uint8_t *const ports[3] = { &PORTB, &PORTC, &PORTD };
+
+ServoBank::ServoBank()
+  : _running(false)
+{
+  for (uint8_t i = 0; i < MAX_CHANNELS; i++) _channels[i].pin = 0xFF;
+}
+
+int8_t ServoBank::Attach(uint8_t pin, int angle)
+{
+  int8_t channel = -1;
+  for (uint8_t i = 0; i < MAX_CHANNELS; i++)
+  {
+    if (_channels[i].pin == pin) return i;     // Уже підключено
+    if (channel < 0 && _channels[i].pin == 0xFF) channel = i;
+  }
+  if (channel < 0) return -1;
+
+  uint8_t port = digitalPinToPort(pin);
+  if (port < PB || port > PD) return -1;
+
+  Channel &c = _channels[channel];
+  c.pin = pin;
+  c.port = port - PB;
+  c.mask = digitalPinToBitMask(pin);
+
+  digitalWrite(pin, LOW);
+  pinMode(pin, OUTPUT);
+
+  // Спершу канал потрапляє в розклад, і лише потім дозволяється апаратний вихід
+  Stage(channel, map(constrain(angle, 0, 180), 0, 180, MIN_PULSE_US, MAX_PULSE_US));
+  Commit();
+
+  if (pin == HW_PIN_A) hardwareA = true;
+  if (pin == HW_PIN_B) hardwareB = true;
+
+  if (!_running) Begin();
+  return channel;
+}
+
+void ServoBank::Detach(int8_t channel)
+{
+  if (channel < 0 || channel >= MAX_CHANNELS || _channels[channel].pin == 0xFF) return;
+
+  // Спершу забороняємо апаратний вихід, потім прибираємо канал з розкладу:
+  // у зворотному порядку таймер міг би підняти пін і вже не скинути його
+  uint8_t pin = _channels[channel].pin;
+  if (pin == HW_PIN_A) hardwareA = false;
+  if (pin == HW_PIN_B) hardwareB = false;
+
+  _channels[channel].pin = 0xFF;
+  Commit();
+}
+
+void ServoBank::Write(int8_t channel, int angle)
+{
+  WriteMicroseconds(channel, map(constrain(angle, 0, 180), 0, 180, MIN_PULSE_US, MAX_PULSE_US));
+}
+
+void ServoBank::WriteMicroseconds(int8_t channel, uint16_t us)
+{
+  if (channel < 0 || channel >= MAX_CHANNELS || _channels[channel].pin == 0xFF) return;
+
+  Stage(channel, us);
+  Commit();
+}
+
+void ServoBank::SetAll(const int angles[], uint8_t count)
+{
+  if (count > MAX_CHANNELS) count = MAX_CHANNELS;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (_channels[i].pin == 0xFF) continue;
+    Stage(i, map(constrain(angles[i], 0, 180), 0, 180, MIN_PULSE_US, MAX_PULSE_US));
+  }
+  Commit();
+}
+
+bool ServoBank::IsHardware(int8_t channel) const
+{
+  if (channel < 0 || channel >= MAX_CHANNELS) return false;
+  return _channels[channel].pin == HW_PIN_A || _channels[channel].pin == HW_PIN_B;
+}
+
+bool ServoBank::CommitPending() const
+{
+  return pendingReady != 0;
+}
+
+void ServoBank::Stage(int8_t channel, uint16_t us)
+{
+  us = constrain(us, MIN_PULSE_US, MAX_PULSE_US);
+  _channels[channel].ticks = us * TICKS_PER_US;
+}
+
+/**
+ * @brief Будує фоновий розклад з таблиці каналів і позначає його готовим.
+ *
+ * Поки pendingReady == 0, переривання не чіпають фоновий буфер, тож його
+ * можна безпечно переписувати навіть посеред кадру.
+ */
+void ServoBank::Commit()
+{
+  pendingReady = 0;
+  ServoSchedule &s = schedules[activeSchedule ^ 1];
+
+  s.set[0] = s.set[1] = s.set[2] = 0;
+  s.groups = 0;
+  s.ticksA = 0;
+  s.hasB = false;
+
+  for (uint8_t i = 0; i < MAX_CHANNELS; i++)
+  {
+    const Channel &c = _channels[i];
+    if (c.pin == 0xFF) continue;
+
+    if (c.pin == HW_PIN_A)
+    {
+      s.ticksA = c.ticks;
+      continue;
+    }
+
+    bool hw = (c.pin == HW_PIN_B);
+    if (hw) s.hasB = true;
+    else s.set[c.port] |= c.mask;
+
+    // Вставка у відсортований за часом список груп (каналів не більше 12)
+    uint8_t k = 0;
+    while (k < s.groups && s.fall[k].ticks < c.ticks) k++;
+
+    if (k == s.groups || s.fall[k].ticks != c.ticks)
+    {
+      for (uint8_t m = s.groups; m > k; m--) s.fall[m] = s.fall[m - 1];
+      s.fall[k].ticks = c.ticks;
+      s.fall[k].clear[0] = s.fall[k].clear[1] = s.fall[k].clear[2] = 0;
+      s.fall[k].hardwareB = false;
+      s.groups++;
+    }
+
+    if (hw) s.fall[k].hardwareB = true;
+    else s.fall[k].clear[c.port] |= c.mask;
+  }
+
+  pendingReady = 1;
+}
+
+/**
+ * @brief Запускає Timer1 і обидва ланцюжки подій.
+ */
+void ServoBank::Begin()
+{
+  uint8_t oldSREG = SREG;
+  cli();
+
+  // Перший розклад одразу стає активним
+  activeSchedule ^= 1;
+  pendingReady = 0;
+
+  TCCR1A = 0;                 // Звичайний режим, виходи поки від’єднані
+  TCCR1B = _BV(CS11);         // Подільник 8
+  TCNT1 = 0;
+
+  aFrame = bFrame = 100 * TICKS_PER_US; // Перший кадр — через 100 мкс
+  aPhase = 0;
+  bIndex = 0;
+  OCR1A = aFrame;
+  OCR1B = bFrame;
+  if (hardwareA) TCCR1A |= COM_A_SET;
+  if (hardwareB) TCCR1A |= COM_B_SET;
+
+  TIFR1 = _BV(OCF1A) | _BV(OCF1B);
+  TIMSK1 |= _BV(OCIE1A) | _BV(OCIE1B);
+
+  _running = true;
+  SREG = oldSREG;
+}
+
+/**
+ * @brief Ланцюжок COMPA: межа кадру, підміна розкладу та імпульс на піні 9.
+ */
+void ServoBank::HandleCompareA()
+{
+  if (aPhase == 0)
+  {
+    // Межа кадру — рівно тут новий розклад набуває чинності
+    if (pendingReady)
+    {
+      activeSchedule ^= 1;
+      pendingReady = 0;
+    }
+
+    uint16_t ticks = schedules[activeSchedule].ticksA;
+    if (hardwareA && ticks != 0)
+    {
+      // Пін уже встановлено апаратно; його скине сам таймер через ticks тактів
+      TCCR1A = (TCCR1A & ~COM_A_MASK) | COM_A_CLEAR;
+      OCR1A = aFrame + ticks;
+      aPhase = 1;
+      return;
+    }
+
+    // Імпульсу в цьому кадрі немає, але таймер міг уже підняти пін — скидаємо
+    if ((TCCR1A & COM_A_MASK) == COM_A_SET)
+    {
+      TCCR1A = (TCCR1A & ~COM_A_MASK) | COM_A_CLEAR;
+      TCCR1C = _BV(FOC1A);
+    }
+  }
+
+  // Кінець імпульсу (або кадр без піна 9) — готуємо початок наступного кадру
+  aFrame += FRAME_TICKS;
+  OCR1A = aFrame;
+  TCCR1A = (TCCR1A & ~COM_A_MASK) | (hardwareA ? COM_A_SET : 0);
+  aPhase = 0;
+}
+
+/**
+ * @brief Ланцюжок COMPB: програмні канали і пін 10 за відсортованим розкладом.
+ */
+void ServoBank::HandleCompareB()
+{
+  const ServoSchedule &s = schedules[activeSchedule];
+
+  if (bIndex == 0)
+  {
+    // Початок кадру: усі програмні піни піднімаються трьома записами в порти
+    *ports[0] |= s.set[0];
+    *ports[1] |= s.set[1];
+    *ports[2] |= s.set[2];
+
+    // OC1B уже встановлено апаратно; PORTB тримаємо в тому ж стані, щоб
+    // від’єднання виходу (COM1B = 00) у наступних групах не змінило рівень
+    if (hardwareB && s.hasB) PORTB |= _BV(PORTB2);
+    bIndex = 1;
+  }
+
+  for (;;)
+  {
+    if (bIndex > s.groups)
+    {
+      // Усі імпульси кадру завершено — чекаємо початку наступного
+      bFrame += FRAME_TICKS;
+      OCR1B = bFrame;
+      TCCR1A = (TCCR1A & ~COM_B_MASK) | (hardwareB ? COM_B_SET : 0);
+      bIndex = 0;
+      return;
+    }
+
+    const ServoFallGroup &g = s.fall[bIndex - 1];
+    uint16_t due = bFrame + g.ticks;
+    uint8_t com = g.hardwareB ? COM_B_CLEAR : 0;
+
+    if ((int16_t)(due - TCNT1) > GUARD_TICKS)
+    {
+      // Подія ще далеко — доручаємо її таймеру
+      TCCR1A = (TCCR1A & ~COM_B_MASK) | com;
+      OCR1B = due;
+      return;
+    }
+
+    // Подія вже настала або настане за кілька мікросекунд — чекаємо точно
+    while ((int16_t)(TCNT1 - due) < 0)
+    {
+    }
+
+    if (com)
+    {
+      // Зазвичай OC1B вже скинуто апаратним збігом; FOC1B робить те саме, коли
+      // подію довелося обробити програмно. PORTB синхронізуємо з виходом.
+      TCCR1A = (TCCR1A & ~COM_B_MASK) | com;
+      TCCR1C = _BV(FOC1B);
+      PORTB &= ~_BV(PORTB2);
+    }
+    *ports[0] &= ~g.clear[0];
+    *ports[1] &= ~g.clear[1];
+    *ports[2] &= ~g.clear[2];
+    bIndex++;
+  }
+}
+
+ISR(TIMER1_COMPA_vect)
+{
+  ServoBank::HandleCompareA();
+}
+
+ISR(TIMER1_COMPB_vect)
+{
+  ServoBank::HandleCompareB();
+}
@@ -0,0 +1,148 @@
+/**
+ * @file ServoBank.h
+ * @brief Керування до 12 сервоприводами від одного таймера (Timer1) без тремтіння імпульсів.
+ *
+ * Бібліотека Servo формує кожен фронт імпульсу у перериванні, тому будь-яке
+ * інше переривання (наприклад, таймер IRremote) зсуває фронти на кілька
+ * мікросекунд — сервопривід «тремтить». ServoBank поєднує два підходи:
+ *
+ * - Піни 9 і 10 (виходи OC1A/OC1B на Uno/Nano) формуються апаратно:
+ *   обидва фронти робить сам таймер у момент збігу, переривання лише
+ *   готує наступну подію. Такі канали не мають тремтіння взагалі.
+ * - Решта пінів (до 12 каналів разом) — програмні: на початку кадру всі
+ *   піднімаються одночасно, а спадні фронти обробляються у порядку
+ *   зростання тривалості (відсортований розклад), близькі за часом —
+ *   в одному перериванні з точним очікуванням потрібного такту.
+ *
+ * Зміни кутів не застосовуються миттєво: новий розклад будується у
+ * фоновому буфері й підміняється на межі кадру, тому SetAll() змінює
+ * кілька осей синхронно, в одному й тому самому кадрі.
+ *
+ * Обмеження: займає Timer1 (несумісна з Servo.h, analogWrite на 9/10,
+ * tone()); піни 9/10 як апаратні — лише для ATmega328P/168.
+ *
+ * @example
+ *  ServoBank servos;
+ *  int8_t pan  = servos.Attach(9);   // апаратний канал
+ *  int8_t tilt = servos.Attach(10);  // апаратний канал
+ *  int8_t grip = servos.Attach(6);   // програмний канал
+ *  int angles[] = {45, 120, 90};
+ *  servos.SetAll(angles, 3);         // усі три осі — з одного кадру
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef SERVOBANK_H
+#define SERVOBANK_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Група програмних каналів, що закінчують імпульс в один і той самий такт.
+ */
+struct ServoFallGroup
+{
+  uint16_t ticks;    ///< Тривалість імпульсу у тактах таймера від початку кадру
+  uint8_t clear[3];  ///< Маски бітів для скидання у PORTB, PORTC, PORTD
+  bool hardwareB;    ///< У цей момент апаратно закінчується імпульс на OC1B (пін 10)
+};
+
+/**
+ * @brief Розклад одного кадру (20 мс) для всіх каналів.
+ */
+struct ServoSchedule
+{
+  uint8_t set[3];                 ///< Маски програмних пінів для PORTB, PORTC, PORTD
+  uint8_t groups;                 ///< Кількість груп спадних фронтів
+  ServoFallGroup fall[12];        ///< Спадні фронти у порядку зростання часу
+  uint16_t ticksA;                ///< Тривалість імпульсу на OC1A (пін 9), 0 — немає
+  bool hasB;                      ///< У розкладі є імпульс на OC1B (пін 10)
+};
+
+/**
+ * @brief Багатоканальний драйвер сервоприводів на Timer1.
+ *
+ * Одночасно може існувати лише один об’єкт ServoBank (таймер один).
+ */
+class ServoBank
+{
+public:
+  static const uint8_t MAX_CHANNELS = 12;       ///< Максимальна кількість каналів
+  static const uint16_t MIN_PULSE_US = 544;     ///< Імпульс для 0° (як у Servo.h)
+  static const uint16_t MAX_PULSE_US = 2400;    ///< Імпульс для 180° (як у Servo.h)
+  static const uint16_t REFRESH_US = 20000;     ///< Період кадру
+
+  ServoBank();
+
+  /**
+   * @brief Підключає сервопривід до піна та задає початковий кут.
+   *
+   * Кут застосовується з першого ж імпульсу — сервопривід не «смикається»
+   * до середнього положення. Таймер запускається під час першого виклику.
+   *
+   * @param pin   Пін сигналу (9 і 10 — апаратні канали без тремтіння).
+   * @param angle Початковий кут 0–180°.
+   * @return Номер каналу або -1, якщо вільних каналів немає.
+   */
+  int8_t Attach(uint8_t pin, int angle = 90);
+
+  /**
+   * @brief Від’єднує канал: імпульси припиняються з наступного кадру.
+   */
+  void Detach(int8_t channel);
+
+  /**
+   * @brief Встановлює кут одного каналу (застосовується на межі кадру).
+   */
+  void Write(int8_t channel, int angle);
+
+  /**
+   * @brief Встановлює тривалість імпульсу одного каналу у мікросекундах.
+   */
+  void WriteMicroseconds(int8_t channel, uint16_t us);
+
+  /**
+   * @brief Встановлює кути каналів 0..count-1 одним пакетом.
+   *
+   * Розклад перебудовується один раз, і всі нові кути починають діяти
+   * в одному й тому самому кадрі.
+   *
+   * @param angles Масив кутів 0–180° (індекс = номер каналу).
+   * @param count  Кількість елементів у масиві.
+   */
+  void SetAll(const int angles[], uint8_t count);
+
+  /**
+   * @brief Чи формується канал апаратно (OC1A/OC1B).
+   */
+  bool IsHardware(int8_t channel) const;
+
+  /**
+   * @brief Чи є зміни, що ще очікують межі кадру.
+   */
+  bool CommitPending() const;
+
+  // Обробники переривань (викликаються з ISR, не для користувача)
+  static void HandleCompareA();
+  static void HandleCompareB();
+
+private:
+  struct Channel
+  {
+    uint8_t pin;      ///< Номер піна Arduino (0xFF — канал вільний)
+    uint8_t port;     ///< 0 — PORTB, 1 — PORTC, 2 — PORTD
+    uint8_t mask;     ///< Біт піна в порту
+    uint16_t ticks;   ///< Тривалість імпульсу у тактах таймера
+  };
+
+  void Begin();
+  void Commit();
+  void Stage(int8_t channel, uint16_t us);
+
+  Channel _channels[MAX_CHANNELS];
+  bool _running;
+};
+
+#endif  // SERVOBANK_H
@@ -0,0 +1,145 @@
+/**
+ * @file StateJournal.cpp
+ * @brief Реалізація журналу стану в EEPROM.
+ *
+ * Формат слота: seq, стан (payloadSize байтів), CRC-8 (поліном 0x07) від
+ * seq і стану. Слот, усі байти якого 0xFF, вважається порожнім.
+ */
+
+#include "StateJournal.h"
+
+#include <avr/eeprom.h>
+
+/**
+ * @brief CRC-8 з поліномом x^8 + x^2 + x + 1 (0x07), початкове значення 0.
+ */
+static uint8_t Crc8(const uint8_t *data, uint8_t len)
+{
+  uint8_t crc = 0;
+  while (len--)
+  {
+    crc ^= *data++;
+    for (uint8_t bit = 0; bit < 8; bit++)
+    {
+      crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+StateJournal::StateJournal(uint16_t base, uint16_t size, uint8_t payloadSize, uint16_t holdMs)
+  : _base(base), _holdMs(holdMs), _nextSlot(0), _seq(0xFF), _dirty(false), _valid(false),
+    _changedMs(0), _records(0)
+{
+  if (payloadSize > MAX_PAYLOAD) payloadSize = MAX_PAYLOAD;
+  _payloadSize = payloadSize;
+  _recordSize = payloadSize + 2;
+
+  uint16_t slots = size / _recordSize;
+  _slots = (slots > MAX_SLOTS) ? MAX_SLOTS : (uint8_t)slots;
+  _writePos = _recordSize;
+}
+
+bool StateJournal::Begin(void *state)
+{
+  if (_slots == 0) return false;
+
+  uint8_t record[MAX_PAYLOAD + 2];
+  int16_t best = -1;
+  uint8_t bestSeq = 0;
+
+  for (uint8_t slot = 0; slot < _slots; slot++)
+  {
+    eeprom_read_block(record, (const void *)SlotAddress(slot), _recordSize);
+
+    bool erased = true;
+    for (uint8_t i = 0; i < _recordSize && erased; i++) erased = (record[i] == 0xFF);
+    if (erased) continue;
+    if (Crc8(record, _recordSize - 1) != record[_recordSize - 1]) continue;   // Обірваний запис
+
+    // Слотів менше 128, тож найновіший seq однозначний за модулем 256
+    if (best < 0 || (int8_t)(record[0] - bestSeq) > 0)
+    {
+      best = slot;
+      bestSeq = record[0];
+      memcpy(_stored, record + 1, _payloadSize);
+    }
+  }
+
+  if (best < 0) return false;
+
+  _seq = bestSeq;
+  _nextSlot = (best + 1) % _slots;
+  _valid = true;
+  memcpy(state, _stored, _payloadSize);
+  return true;
+}
+
+void StateJournal::Save(const void *state)
+{
+  memcpy(_pending, state, _payloadSize);
+  _dirty = true;
+  _changedMs = millis();
+}
+
+/**
+ * @brief Готує запис із відкладеного стану, якщо він відрізняється від збереженого.
+ */
+void StateJournal::StartRecord()
+{
+  _dirty = false;
+  if (_slots == 0) return;
+  if (_valid && memcmp(_pending, _stored, _payloadSize) == 0) return;
+
+  _record[0] = _seq + 1;
+  memcpy(_record + 1, _pending, _payloadSize);
+  _record[_recordSize - 1] = Crc8(_record, _recordSize - 1);
+  _writePos = 0;
+}
+
+/**
+ * @brief Переносить один байт запису в EEPROM, якщо вона вільна.
+ *
+ * @return false, якщо EEPROM ще зайнята попереднім записом.
+ */
+bool StateJournal::WriteStep()
+{
+  if (!eeprom_is_ready()) return false;
+
+  uint8_t *address = (uint8_t *)(SlotAddress(_nextSlot) + _writePos);
+  uint8_t value = _record[_writePos];
+  if (eeprom_read_byte(address) != value) eeprom_write_byte(address, value);  // Однакові байти не перезаписуються
+
+  if (++_writePos == _recordSize)
+  {
+    _seq = _record[0];
+    memcpy(_stored, _record + 1, _payloadSize);
+    _valid = true;
+    _nextSlot = (_nextSlot + 1) % _slots;
+    _records++;
+  }
+  return true;
+}
+
+void StateJournal::Service()
+{
+  if (_writePos < _recordSize)
+  {
+    WriteStep();
+    return;
+  }
+
+  // Стан записується, лише коли перестав змінюватися на holdMs
+  if (_dirty && millis() - _changedMs >= _holdMs) StartRecord();
+}
+
+void StateJournal::Flush()
+{
+  while (_writePos < _recordSize) WriteStep();
+
+  if (_dirty)
+  {
+    StartRecord();
+    while (_writePos < _recordSize) WriteStep();
+  }
+}
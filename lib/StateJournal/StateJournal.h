@@ -0,0 +1,115 @@
+/**
+ * @file StateJournal.h
+ * @brief Журнал стану в EEPROM з рівномірним зношуванням і відкладеним записом.
+ *
+ * Стан програми (кут, режим, калібрування) — це невелика структура, яку
+ * треба пережити вимкнення живлення. Записувати її щоразу в одну й ту саму
+ * адресу не можна: комірка EEPROM витримує ~100 000 записів, а запис
+ * займає 3,3 мс і блокує loop(). Тому:
+ *
+ * - область EEPROM ділиться на слоти; кожен новий запис іде в наступний
+ *   слот по колу, тож зношування розподіляється на всі слоти;
+ * - запис = номер (seq, 8 бітів) + стан + CRC-8; при старті дійсним
+ *   вважається запис з найбільшим seq (порівняння за модулем 256), а
+ *   обірваний посередині запис відкидається за CRC;
+ * - Save() лише копіює стан у RAM; Service() у loop() пише в EEPROM по
+ *   одному байту, коли EEPROM вільна (eeprom_is_ready), тож loop() ніколи
+ *   не чекає. Часті зміни, що надходять протягом holdMs, об’єднуються в
+ *   один запис, а незмінений стан не записується взагалі.
+ *
+ * Відновлення (Begin) читає всю область — для 512 байтів це частки
+ * мілісекунди, тож стан доступний ще до першого імпульсу сервоприводу.
+ *
+ * @example
+ *  struct Settings { uint8_t angle; uint8_t mode; };
+ *  Settings settings = { 90, 0 };
+ *  StateJournal journal(0, 256, sizeof(Settings));
+ *  journal.Begin(&settings);        // Якщо запису немає — settings не змінюється
+ *  ...
+ *  settings.angle = 45;
+ *  journal.Save(&settings);         // Миттєво, без запису в EEPROM
+ *  journal.Service();               // У кожній ітерації loop()
+ *
+ * @author  Дмитро Агеєв
+ * @date    18.10.2026
+ * @license MIT
+ */
+
+#ifndef STATEJOURNAL_H
+#define STATEJOURNAL_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Кільцевий журнал записів фіксованого розміру в EEPROM.
+ */
+class StateJournal
+{
+public:
+  static const uint8_t MAX_PAYLOAD = 16;   ///< Найбільший розмір стану, байтів
+  static const uint8_t MAX_SLOTS = 127;    ///< Щоб порівняння seq за модулем 256 було однозначним
+
+  /**
+   * @param base        Адреса початку області в EEPROM.
+   * @param size        Розмір області у байтах.
+   * @param payloadSize Розмір структури стану (не більше MAX_PAYLOAD).
+   * @param holdMs      Скільки мілісекунд стан має не змінюватися перед записом.
+   */
+  StateJournal(uint16_t base, uint16_t size, uint8_t payloadSize, uint16_t holdMs = 500);
+
+  /**
+   * @brief Знаходить останній дійсний запис і копіює стан у state.
+   *
+   * @return false, якщо дійсних записів немає (state не змінюється).
+   */
+  bool Begin(void *state);
+
+  /**
+   * @brief Запам’ятовує новий стан для відкладеного запису.
+   */
+  void Save(const void *state);
+
+  /**
+   * @brief Крок відкладеного запису: щонайбільше один байт, без очікування.
+   *
+   * Викликається в кожній ітерації loop().
+   */
+  void Service();
+
+  /**
+   * @brief Записує відкладений стан негайно (з очікуванням EEPROM).
+   */
+  void Flush();
+
+  /**
+   * @brief Чи є стан, ще не записаний в EEPROM.
+   */
+  bool Pending() const { return _dirty || _writePos < _recordSize; }
+
+  uint8_t Slots() const { return _slots; }         ///< Кількість слотів у колі
+  uint16_t Records() const { return _records; }    ///< Записів зроблено з моменту запуску
+
+private:
+  void StartRecord();
+  bool WriteStep();
+  uint16_t SlotAddress(uint8_t slot) const { return _base + (uint16_t)slot * _recordSize; }
+
+  uint16_t _base;
+  uint8_t _payloadSize;
+  uint8_t _recordSize;          ///< seq + стан + CRC
+  uint8_t _slots;
+  uint16_t _holdMs;
+
+  uint8_t _nextSlot;            ///< Слот для наступного запису
+  uint8_t _seq;                 ///< seq останнього запису
+  bool _dirty;                  ///< Є незаписаний стан у _pending
+  bool _valid;                  ///< _stored містить стан з EEPROM
+  unsigned long _changedMs;     ///< Момент останнього Save()
+  uint8_t _pending[MAX_PAYLOAD];  ///< Останній збережений через Save() стан
+  uint8_t _stored[MAX_PAYLOAD];   ///< Стан в останньому записі EEPROM
+  uint8_t _record[MAX_PAYLOAD + 2]; ///< Запис, що зараз переноситься в EEPROM
+  uint8_t _writePos;            ///< Наступний байт _record (= _recordSize, якщо запису немає)
+  uint16_t _records;
+};
+
+#endif  // STATEJOURNAL_H
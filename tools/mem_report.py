@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""
+Звіт про статичну пам’ять (flash і RAM) кожного модуля прошивки.
+
+Скрипт розбирає map-файл компонувальника і підсумовує розміри вхідних
+секцій за об’єктними файлами: скільки flash (.text, .progmem, .data — її
+початкові значення теж зберігаються у flash) і скільки SRAM (.data, .bss,
+.noinit) займає кожен модуль проєкту, бібліотеки, ядра Arduino та libc.
+
+Підключення до проєкту PlatformIO (звіт друкується після кожної збірки):
+    [env:uno]
+    extra_scripts = post:../tools/mem_report.py
+
+Окремий запуск для готового map-файлу:
+    python tools/mem_report.py .pio/build/uno/firmware.map [--all]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FLASH_ONLY = (".text", ".progmem", ".init", ".fini", ".vectors", ".trampolines",
+              ".ctors", ".dtors", ".jumptables", ".lowtext", ".hightext")
+RAM_AND_FLASH = (".data", ".rodata")
+RAM_ONLY = (".bss", ".noinit", "COMMON")
+
+# Вхідна секція: " .text.name 0xADDR 0xSIZE файл" (назва може стояти окремим рядком)
+SECTION_RE = re.compile(r"^ (\.[\w.$]+|COMMON)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S.*))?$")
+CONTINUATION_RE = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S.*)$")
+ARCHIVE_RE = re.compile(r"^(.*?)([^/\\]+)\.a\((.+)\)$")
+
+
+def classify(section):
+    for prefix in FLASH_ONLY:
+        if section.startswith(prefix):
+            return True, False
+    for prefix in RAM_AND_FLASH:
+        if section.startswith(prefix):
+            return True, True
+    for prefix in RAM_ONLY:
+        if section.startswith(prefix):
+            return False, True
+    return False, False
+
+
+def module_name(path):
+    """Коротка назва модуля: «архів: файл» для бібліотек, шлях від src/ для проєкту."""
+    path = path.strip()
+    m = ARCHIVE_RE.match(path)
+    if m:
+        archive = m.group(2)
+        member = os.path.basename(m.group(3))
+        if member.endswith(".o"):
+            member = member[:-2]
+        return "%s: %s" % (archive, member)
+    path = path.replace("\\", "/")
+    if path.endswith(".o"):
+        path = path[:-2]
+    i = path.rfind("/src/")
+    if i >= 0:
+        return path[i + 1:]
+    # Бібліотека, зібрана без архіву: «Бібліотека/файл»
+    return "/".join(path.split("/")[-2:])
+
+
+def parse_map(lines):
+    """Повертає {модуль: [flash, ram]} для вхідних секцій із розміром > 0."""
+    modules = {}
+    in_map = False
+    pending = None
+
+    for line in lines:
+        line = line.rstrip("\n")
+        if line.startswith("Linker script and memory map"):
+            in_map = True
+            continue
+        if not in_map:
+            continue
+        if line.startswith("/DISCARD/"):
+            break
+
+        if pending is not None:
+            m = CONTINUATION_RE.match(line)
+            section, pending = pending, None
+            if m:
+                add(modules, section, int(m.group(2), 16), m.group(3))
+                continue
+
+        m = SECTION_RE.match(line)
+        if not m:
+            continue
+        if m.group(2) is None:
+            pending = m.group(1)   # Довга назва — адреса й розмір у наступному рядку
+        else:
+            add(modules, m.group(1), int(m.group(3), 16), m.group(4))
+
+    return modules
+
+
+def add(modules, section, size, path):
+    if size == 0 or "load address" in path:
+        return
+    flash, ram = classify(section)
+    if not flash and not ram:
+        return
+    entry = modules.setdefault(module_name(path), [0, 0])
+    if flash:
+        entry[0] += size
+    if ram:
+        entry[1] += size
+
+
+def report(map_path, show_all=False, out=sys.stdout):
+    with open(map_path, errors="replace") as f:
+        modules = parse_map(f)
+
+    rows = sorted(modules.items(), key=lambda kv: (kv[1][1], kv[1][0]), reverse=True)
+    total_flash = sum(v[0] for v in modules.values())
+    total_ram = sum(v[1] for v in modules.values())
+
+    out.write("\nСтатична пам'ять за модулями (%s)\n" % map_path)
+    out.write("%-48s %8s %8s\n" % ("модуль", "flash", "RAM"))
+    hidden = [0, 0]
+    for name, (flash, ram) in rows:
+        if not show_all and ram == 0 and flash < 256:
+            hidden[0] += flash
+            continue
+        out.write("%-48s %8d %8d\n" % (name[:48], flash, ram))
+    if hidden[0]:
+        out.write("%-48s %8d %8d\n" % ("(інші дрібні модулі без RAM)", hidden[0], 0))
+    out.write("%-48s %8d %8d\n" % ("РАЗОМ", total_flash, total_ram))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("map", help="map-файл компонувальника (-Wl,-Map)")
+    parser.add_argument("--all", action="store_true", help="показати всі модулі, навіть дрібні")
+    args = parser.parse_args()
+    report(args.map, args.all)
+
+
+# Запуск як extra_script PlatformIO (SCons надає Import) або з командного рядка
+try:
+    Import("env")  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main()
+else:
+    _map = os.path.join(env.subst("$BUILD_DIR"), "firmware.map")  # noqa: F821
+    env.Append(LINKFLAGS=["-Wl,-Map," + _map])  # noqa: F821
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf",  # noqa: F821
+                      lambda target, source, env: report(_map))